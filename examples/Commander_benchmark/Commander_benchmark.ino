@@ -0,0 +1,613 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * This example sketch measures the performance of
+ * Commander-API with generated command sets.
+*/
+
+// Necessary includes
+#include "Commander-API.hpp"
+#include "Commander-IO.hpp"
+
+// The benchmark is executed with these command counts.
+// Bigger command sets need a lot of RAM, so on small
+// devices the allocation will fail and the step will
+// be skipped.
+const uint32_t benchmarkSizes[] = { 10, 100, 1000, 10000 };
+
+// Every generated command name has this many characters.
+// The terminator character is included.
+#define BENCHMARK_NAME_LENGTH 8
+
+// Dummy function for the generated commands.
+void dummy_func( char *args, Stream *response ){
+
+}
+
+// Simple pseudo random generator, to get the same
+// command set on every platform.
+uint32_t benchmarkSeed = 1;
+
+uint32_t benchmarkRandom(){
+
+  benchmarkSeed = benchmarkSeed * 1103515245UL + 12345UL;
+  return benchmarkSeed >> 8;
+
+}
+
+// Generate a unique name for the i-th command. The first
+// characters are random to mix the order of the commands,
+// the last ones are encoding the index to make them unique.
+void generateName( char *name, uint32_t index ){
+
+  uint8_t i;
+
+  for( i = 0; i < 3; i++ ){
+
+    name[ i ] = 'a' + ( benchmarkRandom() % 26 );
+
+  }
+
+  for( i = BENCHMARK_NAME_LENGTH - 2; i >= 3; i-- ){
+
+    name[ i ] = 'a' + ( index % 26 );
+    index /= 26;
+
+  }
+
+  name[ BENCHMARK_NAME_LENGTH - 1 ] = '\0';
+
+}
+
+// Counts the character comparisons of the reference search.
+uint32_t referenceCompares;
+
+// Regular strcmp, that counts the compared characters.
+int countingStrcmp( const char *str1, const char *str2 ){
+
+  while( true ){
+
+    referenceCompares++;
+
+    if( ( *str1 == '\0' ) || ( *str1 != *str2 ) ){
+
+      return (uint8_t)*str1 - (uint8_t)*str2;
+
+    }
+
+    str1++;
+    str2++;
+
+  }
+
+}
+
+// Binary search with strcmp at every step, like the
+// search worked before the prefix words and fingerprints.
+Commander::API_t* referenceSearch( Commander &commander, uint32_t size, const char *name ){
+
+  int32_t low = 0;
+  int32_t high = size - 1;
+  int32_t mid;
+  int result;
+
+  while( low <= high ){
+
+    mid = ( low + high ) / 2;
+    result = countingStrcmp( commander[ mid ] -> name, name );
+
+    if( result == 0 ){
+      return commander[ mid ];
+    }
+
+    if( result < 0 ){
+      low = mid + 1;
+    }
+
+    else{
+      high = mid - 1;
+    }
+
+  }
+
+  return NULL;
+
+}
+
+void benchmarkLookup( Commander &commander, uint32_t size, char *names ){
+
+  uint32_t i;
+  uint32_t start;
+  uint32_t stop;
+
+  start = micros();
+
+  for( i = 0; i < size; i++ ){
+
+    if( commander[ (const char*)&names[ i * BENCHMARK_NAME_LENGTH ] ] == NULL ){
+
+      Serial.println( "Lookup error!" );
+
+    }
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tlookup took " );
+  Serial.print( (float)( stop - start ) / size );
+  Serial.println( " us in average" );
+
+  // Polling the same command is the best case for the lookup cache.
+  start = micros();
+
+  for( i = 0; i < size; i++ ){
+
+    commander[ (const char*)&names[ 0 ] ];
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\trepeated lookup took " );
+  Serial.print( (float)( stop - start ) / size );
+  Serial.println( " us in average" );
+
+  #if ( COMMANDER_LOOKUP_CACHE_SIZE > 0 )
+
+  Serial.print( "\tlookup cache hits: " );
+  Serial.print( commander.cacheHitCounter );
+  Serial.print( " misses: " );
+  Serial.println( commander.cacheMissCounter );
+
+  #endif
+
+  #ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+  // Count the polled command again, then move it to the root.
+  if( commander.enableWeightedSearch() ){
+
+    for( i = 0; i < size; i++ ){
+
+      commander[ (const char*)&names[ 0 ] ];
+
+    }
+
+    commander.rebuildWeightedSearch();
+
+    start = micros();
+
+    for( i = 0; i < size; i++ ){
+
+      commander[ (const char*)&names[ 0 ] ];
+
+    }
+
+    stop = micros();
+
+    Serial.print( "\trepeated lookup with weighted tree took " );
+    Serial.print( (float)( stop - start ) / size );
+    Serial.println( " us in average" );
+
+    commander.disableWeightedSearch();
+
+  }
+
+  #endif
+
+  referenceCompares = 0;
+
+  for( i = 0; i < size; i++ ){
+
+    referenceSearch( commander, size, &names[ i * BENCHMARK_NAME_LENGTH ] );
+
+  }
+
+  Serial.print( "\tcharacter comparisons per lookup with strcmp: " );
+  Serial.println( (float)referenceCompares / size );
+
+  #ifdef COMMANDER_ENABLE_STATISTICS
+
+  Serial.print( "\tword and character comparisons per lookup with prefix words: " );
+  Serial.println( (float)commander.compareCounter / commander.lookupCounter );
+
+  #else
+
+  Serial.println( "\tenable COMMANDER_ENABLE_STATISTICS to count the comparisons of Commander" );
+
+  #endif
+
+}
+
+#ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+// Buffer for the help text.
+char helpBuffer[ 256 ];
+
+#endif
+
+// Generate the help text. The default response channel
+// drops the data, so only the generation is measured.
+void benchmarkHelp( Commander &commander ){
+
+  uint32_t start;
+  uint32_t stop;
+
+  start = micros();
+  commander.execute( "help" );
+  stop = micros();
+
+  Serial.print( "\thelp took " );
+  Serial.print( stop - start );
+  Serial.println( " us" );
+
+  #ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+  commander.attachHelpBuffer( helpBuffer, sizeof( helpBuffer ), true );
+
+  start = micros();
+  commander.execute( "help" );
+  stop = micros();
+
+  Serial.print( "\thelp with buffer took " );
+  Serial.print( stop - start );
+  Serial.println( " us" );
+
+  // If the text fits in the buffer, the second one comes from the cache.
+  start = micros();
+  commander.execute( "help" );
+  stop = micros();
+
+  Serial.print( "\thelp again took " );
+  Serial.print( stop - start );
+  Serial.println( " us" );
+
+  #endif
+
+}
+
+// Add and remove the commands at runtime with the dynamic command tree.
+void benchmarkDynamic( Commander::API_t *tree, uint32_t size ){
+
+  Commander commander;
+
+  Commander::commandNode_t *pool;
+
+  uint32_t i;
+  uint32_t start;
+  uint32_t stop;
+
+  pool = (Commander::commandNode_t*)malloc( size * sizeof( Commander::commandNode_t ) );
+
+  if( pool == NULL ){
+
+    Serial.println( "\tnot enough memory for the node pool, skipped." );
+    return;
+
+  }
+
+  commander.attachNodePoolFunction( pool, size );
+
+  start = micros();
+
+  for( i = 0; i < size; i++ ){
+
+    commander.addCommand( &tree[ i ] );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\taddCommand took " );
+  Serial.print( (float)( stop - start ) / size );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < size; i++ ){
+
+    commander.removeCommand( tree[ i ].name );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tremoveCommand took " );
+  Serial.print( (float)( stop - start ) / size );
+  Serial.println( " us in average" );
+
+  free( pool );
+
+}
+
+// Handwritten command function, that parses the arguments with sscanf.
+void scanfAdd_func( char *args, Stream *response ){
+
+  int a;
+  int b;
+
+  if( sscanf( args, "%d %d", &a, &b ) != 2 ){
+
+    response -> print( "Argument error!" );
+    return;
+
+  }
+
+  response -> print( a + b );
+
+}
+
+// The same function for the typed binding.
+int add( int a, int b ){
+
+  return a + b;
+
+}
+
+Commander::API_t bindTree[] = {
+  apiElement( "scanfAdd", "", scanfAdd_func ),
+  apiBind( "bindAdd", "", add )
+};
+
+// Compare the generated argument parser with sscanf.
+void benchmarkBinding(){
+
+  Commander commander;
+
+  uint32_t i;
+  uint32_t start;
+  uint32_t stop;
+
+  commander.attachTree( bindTree );
+  commander.init();
+
+  Serial.println( "Argument parsing:" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    commander.execute( "scanfAdd 1234 -5678" );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tsscanf command took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    commander.execute( "bindAdd 1234 -5678" );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tbound command took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+}
+
+// Compare the number module with the libc and the Print functions.
+void benchmarkNumbers(){
+
+  // The formatted numbers are dropped by this channel.
+  commandResponse nullResponse;
+
+  // The compiler can not drop the calls, if the results are used.
+  volatile int32_t intSum = 0;
+  volatile float floatSum = 0;
+
+  int intValue;
+  int32_t intResult;
+  float floatResult;
+
+  uint32_t i;
+  uint32_t start;
+  uint32_t stop;
+
+  Serial.println( "Number parsing and formatting:" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    sscanf( "-123456", "%d", &intValue );
+    intSum += intValue;
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tsscanf integer took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    commanderParseInt( "-123456", &intResult );
+    intSum += intResult;
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tcommanderParseInt took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    floatSum += atof( "3.1415926" );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tatof took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    commanderParseFloat( "3.1415926", &floatResult );
+    floatSum += floatResult;
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tcommanderParseFloat took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    nullResponse.print( 3.1415926f, 6 );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tprint( float, 6 ) took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+  start = micros();
+
+  for( i = 0; i < 1000; i++ ){
+
+    commanderPrintFloat( &nullResponse, 3.1415926f, 6 );
+
+  }
+
+  stop = micros();
+
+  Serial.print( "\tcommanderPrintFloat took " );
+  Serial.print( (float)( stop - start ) / 1000 );
+  Serial.println( " us in average" );
+
+}
+
+void benchmarkInit( uint32_t size ){
+
+  Commander commander;
+
+  Commander::API_t *tree;
+  char *names;
+
+  uint32_t i;
+  uint32_t start;
+  uint32_t stop;
+
+  tree = (Commander::API_t*)malloc( size * sizeof( Commander::API_t ) );
+  names = (char*)malloc( size * BENCHMARK_NAME_LENGTH );
+
+  if( ( tree == NULL ) || ( names == NULL ) ){
+
+    Serial.print( size );
+    Serial.println( " commands: not enough memory, skipped." );
+
+    free( tree );
+    free( names );
+    return;
+
+  }
+
+  for( i = 0; i < size; i++ ){
+
+    generateName( &names[ i * BENCHMARK_NAME_LENGTH ], i );
+
+    Commander::API_t element = apiElement( &names[ i * BENCHMARK_NAME_LENGTH ], "", dummy_func );
+    tree[ i ] = element;
+
+  }
+
+  commander.attachTreeFunction( tree, size );
+
+  start = micros();
+  commander.init();
+  stop = micros();
+
+  Serial.print( size );
+  Serial.print( " commands: init took " );
+  Serial.print( stop - start );
+  Serial.println( " us" );
+
+  benchmarkLookup( commander, size, names );
+  benchmarkHelp( commander );
+  benchmarkDynamic( tree, size );
+
+  free( tree );
+  free( names );
+
+}
+
+void setup() {
+
+  uint32_t i;
+
+  Serial.begin( 115200 );
+
+  // If you using Atmega32U4, the code will wait, until
+  // you open the serial port.
+  while( !Serial );
+
+  Serial.println( "---- Commander benchmark ----" );
+
+  // Size report of the command structure.
+  Serial.print( "API_t size: " );
+  Serial.print( sizeof( Commander::API_t ) );
+  Serial.println( " bytes per command" );
+
+  #ifdef COMMANDER_LEAN
+
+  Serial.println( "Lean profile: the descriptions are not compiled." );
+
+  #else
+
+  // The lean profile removes the description pointers
+  // and the description texts as well.
+  #ifdef __AVR__
+  Serial.print( "The lean profile saves " );
+  Serial.print( sizeof( const char* ) + sizeof( __FlashStringHelper* ) );
+  #else
+  Serial.print( "The lean profile saves " );
+  Serial.print( sizeof( const char* ) );
+  #endif
+  Serial.println( " bytes per command, plus the description text." );
+
+  #endif
+
+  for( i = 0; i < sizeof( benchmarkSizes ) / sizeof( benchmarkSizes[ 0 ] ); i++ ){
+
+    benchmarkInit( benchmarkSizes[ i ] );
+
+  }
+
+  benchmarkBinding();
+  benchmarkNumbers();
+
+}
+
+void loop() {
+
+}
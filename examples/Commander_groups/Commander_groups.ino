@@ -0,0 +1,158 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * This example sketch shows how to create
+ * command groups with Commander-API library.
+*/
+
+// Necessary includes
+#include "Commander-API.hpp"
+#include "Commander-IO.hpp"
+
+// Every group is a separate Commander object with its own
+// commands. The main object only knows the name of the groups,
+// so its search index stays small. The group objects have to
+// be global, because their address is used in the API-tree.
+// The main object reads the commands from Serial with the
+// update function, so it needs a line buffer.
+CommanderLine commander;
+Commander wifiGroup;
+Commander ledGroup;
+
+// We have to create the prototypes functions for our commands.
+void scan_func( char *args, Stream *response );
+void stat_func( char *args, Stream *response );
+void on_func( char *args, Stream *response );
+void off_func( char *args, Stream *response );
+void uptime_func( char *args, Stream *response );
+
+// Commands of the wifi group.
+Commander::API_t wifi_tree[] = {
+    apiElement( "scan", "Scan the available networks.", scan_func ),
+    apiElement( "stat", "Print the connection status.", stat_func )
+};
+
+// Commands of the led group.
+Commander::API_t led_tree[] = {
+    apiElement( "on", "Turn on the built-in LED.", on_func ),
+    apiElement( "off", "Turn off the built-in LED.", off_func )
+};
+
+// The top level commands. The apiGroup macro creates a command,
+// that passes the rest of the command line to the group.
+Commander::API_t API_tree[] = {
+    apiGroup( "wifi", "Wifi commands. Type 'wifi' to list them.", wifiGroup ),
+    apiGroup( "led", "LED commands. Type 'led' to list them.", ledGroup ),
+    apiElement( "uptime", "Print the time since the start.", uptime_func )
+};
+
+void setup() {
+
+  // Set the LED pin to output, and turn it off.
+  pinMode( LED_BUILTIN, OUTPUT );
+  digitalWrite( LED_BUILTIN, 0 );
+
+  Serial.begin( 115200 );
+
+  // If you using Atmega32U4, the code will wait, until
+  // you open the serial port.
+  while( !Serial );
+
+  // Every group has to be initialized like the main object.
+  wifiGroup.attachTree( wifi_tree );
+  wifiGroup.init();
+
+  ledGroup.attachTree( led_tree );
+  ledGroup.init();
+
+  commander.attachTree( API_tree );
+  commander.init();
+
+  // Example 1.
+  Serial.println();
+  Serial.println( "Example 1." );
+
+  // The help command lists the groups and the top level commands.
+  commander.execute( "help", &Serial );
+
+  // Example 2.
+  Serial.println();
+  Serial.println( "Example 2." );
+
+  // The name of a group without subcommand lists the commands of the group.
+  commander.execute( "wifi", &Serial );
+
+  // Example 3.
+  Serial.println();
+  Serial.println( "Example 3." );
+
+  // The subcommand is searched only in the group.
+  commander.execute( "wifi scan", &Serial );
+  commander.execute( "led on", &Serial );
+
+  // Example 4.
+  Serial.println();
+  Serial.println( "Example 4." );
+
+  // Every group has its own help command as well.
+  commander.execute( "wifi help -d", &Serial );
+  commander.execute( "wifi stat?", &Serial );
+
+}
+
+void loop() {
+
+  // The update function reads the incoming characters from Serial
+  // without waiting. Every command from Serial is terminated with
+  // a new-line or a carriage-return character. When a full command
+  // arrived, it is executed and the response is sent to Serial.
+  // The commands that do not fit in the buffer are dropped.
+  commander.update( &Serial );
+
+}
+
+/// This is an example function for the wifi scan command
+void scan_func( char *args, Stream *response )
+{
+
+  response -> print( "No networks found.\r\n" );
+
+}
+
+/// This is an example function for the wifi stat command
+void stat_func( char *args, Stream *response )
+{
+
+  response -> print( "Not connected.\r\n" );
+
+}
+
+/// This is an example function for the led on command
+void on_func( char *args, Stream *response )
+{
+
+  digitalWrite( LED_BUILTIN, 1 );
+
+}
+
+/// This is an example function for the led off command
+void off_func( char *args, Stream *response )
+{
+
+  digitalWrite( LED_BUILTIN, 0 );
+
+}
+
+/// This is an example function for the uptime command
+void uptime_func( char *args, Stream *response )
+{
+
+  response -> print( millis() );
+  response -> print( " ms\r\n" );
+
+}
@@ -0,0 +1,162 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * This example sketch shows how to share the commands
+ * between more tasks, and how to replace them while
+ * the tasks are running.
+*/
+
+// Necessary includes
+#include "Commander-API.hpp"
+#include "Commander-IO.hpp"
+
+// The shared index is opt-in. Uncomment COMMANDER_ENABLE_SHARED_INDEX
+// in Commander-Settings.hpp to build this example.
+#ifndef COMMANDER_ENABLE_SHARED_INDEX
+  #error "COMMANDER_ENABLE_SHARED_INDEX has to be enabled in Commander-Settings.hpp!"
+#endif
+
+// Every task needs its own Commander object, because
+// the objects store the command that is being executed.
+// The objects read the same search index through this
+// publication point.
+Commander::sharedIndex_t sharedIndex;
+
+// Object for the Serial terminal. It is used by the loop task.
+// It reads the commands with the update function, so it needs
+// a line buffer.
+CommanderLine commander;
+
+// Object for the background task.
+Commander backgroundCommander;
+
+// We have to create the prototypes functions for our commands.
+void uptime_func( char *args, Stream *response );
+void plugin_func( char *args, Stream *response );
+void hello_func( char *args, Stream *response );
+
+// The commands of the application.
+Commander::API_t API_tree[] = {
+    apiElement( "uptime", "Print the time since the start.", uptime_func ),
+    apiElement( "plugin", "Load or unload the plugin commands.", plugin_func )
+};
+
+// The commands of the plugin.
+Commander::API_t plugin_tree[] = {
+    apiElement( "hello", "Say hello from the plugin.", hello_func )
+};
+
+// This flag is set by the plugin command. The new index must not
+// be published from a command function, because the publisher
+// waits for the running commands, so it is done by another task.
+volatile bool pluginRequest = false;
+bool pluginLoaded = false;
+
+// Create a new index from the trees and publish it.
+void publishCommands( bool withPlugin ){
+
+  Commander::commandTree_t trees[] = {
+    { API_tree, sizeof( API_tree ) / sizeof( API_tree[ 0 ] ) },
+    { plugin_tree, sizeof( plugin_tree ) / sizeof( plugin_tree[ 0 ] ) }
+  };
+
+  Commander::commandIndex_t newIndex;
+
+  if( !Commander::createIndex( &newIndex, trees, withPlugin ? 2 : 1 ) ){
+
+    Serial.println( "Not enough memory for the index!" );
+    return;
+
+  }
+
+  // The running lookups finish with the old index, the next
+  // ones use the new index. The old one is released after that.
+  Commander::publishIndex( &sharedIndex, &newIndex );
+
+}
+
+// This task publishes the new command sets.
+void publisherTask( void *parameters ){
+
+  while( true ){
+
+    if( pluginRequest ){
+
+      pluginLoaded = !pluginLoaded;
+      publishCommands( pluginLoaded );
+      pluginRequest = false;
+
+    }
+
+    vTaskDelay( 10 / portTICK_PERIOD_MS );
+
+  }
+
+}
+
+// This task executes a command periodically with its own object.
+void backgroundTask( void *parameters ){
+
+  while( true ){
+
+    backgroundCommander.execute( "hello" );
+    vTaskDelay( 1000 / portTICK_PERIOD_MS );
+
+  }
+
+}
+
+void setup() {
+
+  Serial.begin( 115200 );
+
+  // Publish the first version before the tasks start.
+  publishCommands( false );
+
+  commander.attachSharedIndex( &sharedIndex );
+  backgroundCommander.attachSharedIndex( &sharedIndex );
+
+  xTaskCreate( publisherTask, "publisher", 4096, NULL, 1, NULL );
+  xTaskCreate( backgroundTask, "background", 4096, NULL, 1, NULL );
+
+  Serial.println( "Type 'plugin' to load or unload the plugin commands." );
+
+}
+
+void loop() {
+
+  // Read and execute the commands from Serial.
+  commander.update( &Serial );
+
+}
+
+/// This is an example function for the uptime command
+void uptime_func( char *args, Stream *response )
+{
+
+  response -> print( millis() );
+  response -> print( " ms\r\n" );
+
+}
+
+/// This is an example function for the plugin command
+void plugin_func( char *args, Stream *response )
+{
+
+  pluginRequest = true;
+  response -> print( "The plugin will be changed.\r\n" );
+
+}
+
+/// This is an example function for the hello command
+void hello_func( char *args, Stream *response )
+{
+
+  Serial.print( "Hello from the plugin!\r\n" );
+
+}
@@ -20,7 +20,9 @@
 #define LED_PIN 2
 
 // We have to create an object from Commander class.
-Commander commander;
+// The CommanderLine class has a line buffer, so it
+// can read the commands with the update function.
+CommanderLine commander;
 
 // We have to create the prototypes functions for our commands.
 // The arguments has to be the same for all command functions.
@@ -91,11 +93,11 @@ void setup() {
   Serial.println( "Step 2." );
 
   // After we attached the API_tree, Commander has to initialise
-  // itself for the fastes runtime possible. It creates a balanced
-  // binary tree from the API_tree to boost the search speed.
-  // This part uses some recursion, to make the code space small.
-  // But recursion is a bit stack hungry, so please initialise
-  // Commander at the beginning of your code to prevent stack-overlow.
+  // itself for the fastes runtime possible. It creates a
+  // compact search index in alphabetical order from the API_tree
+  // to boost the search speed. The API_tree itself is not modified. The index is allocated in the heap, so please
+  // initialize Commander at the beginning of your code to prevent
+  // memory fragmentation.
   commander.init();
 
 
@@ -204,61 +206,18 @@ void setup() {
 // the Serial monitor to try it. Set the line ending
 // to new-line and play with the commands.
 
-// This is a buffer to hold the incoming command.
-char commandFromSerial[ 20 ];
-
-// This variable tracks the location of the next free
-// space in the commandFromSerial buffer.
-uint8_t commandIndex = 0;
-
 void loop() {
 
-  char c;
-
   WiFiClient client = server.available();
 
   if( client ){
 
     while( client.connected() ){
 
-      while( client.available() ){
-
-        // Read the next incoming character.
-        c = client.read();
-
-        // Every command from Serial is terminated with a new-line
-        // character. If a new-line character arrives we have to
-        // terminate the string in the commandFromSerial buffer,
-        // and execute it. After execution we have to reset the
-        // commandIndex counter to zero.
-        if( c == '\n' ){
-
-          commandFromSerial[ commandIndex ] = '\0';
-          commander.execute( commandFromSerial, &client );
-          commandIndex = 0;
-
-        }
-
-        // If we have a carriage-return character we simply
-        // ignore it.
-        else if( c == '\r' ){
-          continue;
-        }
-
-        // Every other case we just put the data to the next
-        // free space in the commandFromSerial buffer, increment
-        // the commandIndex, and check if it want's to overflow.
-        else{
-
-          commandFromSerial[ commandIndex ] = c;
-          commandIndex++;
-          if( commandIndex >= 20 ){
-            commandIndex = 19;
-          }
-
-        }
-
-      }
+      // The update function reads the available characters
+      // from the client without waiting, and executes the
+      // complete lines. The response is sent to the client.
+      commander.update( &client );
 
       delay( 10 );
 
@@ -266,45 +225,12 @@ void loop() {
 
   }
 
-  // Check if there is any data incoming.
-  while( Serial.available() ){
-
-    // Read the next incoming character.
-    c = Serial.read();
-
-    // Every command from Serial is terminated with a new-line
-    // character. If a new-line character arrives we have to
-    // terminate the string in the commandFromSerial buffer,
-    // and execute it. After execution we have to reset the
-    // commandIndex counter to zero.
-    if( c == '\n' ){
-
-      commandFromSerial[ commandIndex ] = '\0';
-      commander.execute( commandFromSerial, &Serial );
-      commandIndex = 0;
-
-    }
-
-    // If we have a carriage-return character we simply
-    // ignore it.
-    else if( c == '\r' ){
-      continue;
-    }
-
-    // Every other case we just put the data to the next
-    // free space in the commandFromSerial buffer, increment
-    // the commandIndex, and check if it want's to overflow.
-    else{
-
-      commandFromSerial[ commandIndex ] = c;
-      commandIndex++;
-      if( commandIndex >= 20 ){
-        commandIndex = 19;
-      }
-
-    }
-
-  }
+  // The update function reads the incoming characters from Serial
+  // without waiting. Every command from Serial is terminated with
+  // a new-line or a carriage-return character. When a full command
+  // arrived, it is executed and the response is sent to Serial.
+  // The commands that do not fit in the buffer are dropped.
+  commander.update( &Serial );
 
 }
 
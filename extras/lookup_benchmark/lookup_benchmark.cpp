@@ -0,0 +1,230 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * Benchmark of the index build and the command lookup on a Linux host.
+ *
+ * Trees with different number of commands are attached, the init
+ * function is timed, then every command is searched many times. The
+ * same names are searched with strcmp and bsearch as a reference, it
+ * is the cost of a plain binary search without the search index.
+ *
+ * The search compares the first word of the names and the fingerprints
+ * before the characters. The names of the second run have a long common
+ * beginning, like the settings of a device, so the first words are the
+ * same and the comparison has to go on to the rest of the name.
+ *
+ * Build and run from the root of the repository:
+ *
+ *   g++ -std=c++11 -O2 -DARDUINO=100 \
+ *       -Iextras/shared_index_stress/host -Isrc \
+ *       src/Commander-API.cpp src/Commander-IO.cpp src/Commander-Arguments.cpp src/Commander-Number.cpp \
+ *       extras/lookup_benchmark/lookup_benchmark.cpp -o lookup_benchmark
+ *   ./lookup_benchmark [ rounds ]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "Commander-API.hpp"
+
+// Maximum number of commands in one tree.
+#define BENCHMARK_MAX_COMMANDS 2048
+
+// Size of the generated command names.
+#define BENCHMARK_NAME_SIZE 24
+
+// The output of the commands is dropped.
+class nullStream : public Stream{
+
+public:
+
+  int    available()          { return 0; }
+  int    read()               { return -1; }
+  int    peek()               { return -1; }
+  size_t write( uint8_t b )   { return 1; }
+
+};
+
+// The commands count the calls, so they can not be optimized out.
+static volatile uint32_t calls = 0;
+
+void benchmark_func( char *args, Stream *response ){ calls++; }
+
+static char names[ BENCHMARK_MAX_COMMANDS ][ BENCHMARK_NAME_SIZE ];
+static Commander::API_t tree[ BENCHMARK_MAX_COMMANDS ];
+
+// The names in alphabetical order for the reference search.
+static const char *sortedNames[ BENCHMARK_MAX_COMMANDS ];
+
+// Elapsed time since start in nanoseconds.
+static double elapsed_ns( std::chrono::steady_clock::time_point start ){
+
+  return std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count();
+
+}
+
+static int compare_names( const void *a, const void *b ){
+
+  return strcmp( *(const char* const*)a, *(const char* const*)b );
+
+}
+
+// The names are generated in a scrambled order, so
+// the tree is not sorted when it is attached.
+static void generate_names( uint32_t count, bool commonPrefix ){
+
+  static const char *groups[] = { "wifi", "gpio", "adc", "config", "sensor", "motor", "log", "net" };
+
+  uint32_t i;
+  uint32_t scrambled;
+
+  for( i = 0; i < count; i++ ){
+
+    scrambled = ( i * 7919 ) % count;
+
+    if( commonPrefix ){
+
+      snprintf( names[ i ], BENCHMARK_NAME_SIZE, "configParameter%u", scrambled );
+
+    }
+
+    else{
+
+      snprintf( names[ i ], BENCHMARK_NAME_SIZE, "%s%u", groups[ scrambled % 8 ], scrambled );
+
+    }
+
+    tree[ i ] = (Commander::API_t)apiElement( names[ i ], "Benchmark command.", benchmark_func );
+    sortedNames[ i ] = names[ i ];
+
+  }
+
+  qsort( sortedNames, count, sizeof( sortedNames[ 0 ] ), compare_names );
+
+}
+
+static void benchmark( uint32_t count, uint32_t rounds, bool commonPrefix ){
+
+  Commander commander;
+  nullStream out;
+
+  std::chrono::steady_clock::time_point start;
+  double initTime;
+  double lookupTime;
+  double executeTime;
+  double referenceTime;
+
+  uint32_t found = 0;
+  uint32_t i;
+  uint32_t j;
+
+  const char *key;
+
+  generate_names( count, commonPrefix );
+
+  commander.attachTreeFunction( tree, count );
+
+  start = std::chrono::steady_clock::now();
+
+  for( j = 0; j < rounds; j++ ){
+
+    commander.init();
+
+  }
+
+  initTime = elapsed_ns( start ) / rounds;
+
+  start = std::chrono::steady_clock::now();
+
+  for( j = 0; j < rounds; j++ ){
+
+    for( i = 0; i < count; i++ ){
+
+      found += commander[ (const char*)names[ i ] ] != NULL;
+
+    }
+
+  }
+
+  lookupTime = elapsed_ns( start ) / ( (double)rounds * count );
+
+  start = std::chrono::steady_clock::now();
+
+  for( j = 0; j < rounds; j++ ){
+
+    for( i = 0; i < count; i++ ){
+
+      commander.execute( (const char*)names[ i ], &out );
+
+    }
+
+  }
+
+  executeTime = elapsed_ns( start ) / ( (double)rounds * count );
+
+  start = std::chrono::steady_clock::now();
+
+  for( j = 0; j < rounds; j++ ){
+
+    for( i = 0; i < count; i++ ){
+
+      key = names[ i ];
+      found += bsearch( &key, sortedNames, count, sizeof( sortedNames[ 0 ] ), compare_names ) != NULL;
+
+    }
+
+  }
+
+  referenceTime = elapsed_ns( start ) / ( (double)rounds * count );
+
+  if( ( found != 2 * rounds * count ) || ( calls != rounds * count ) ){
+
+    printf( "FAILED: not every command was found with %u commands!\n", count );
+    exit( 1 );
+
+  }
+
+  printf( "%5u commands: init %9.0f ns, lookup %6.1f ns, execute %6.1f ns, strcmp bsearch %6.1f ns\n", count, initTime, lookupTime, executeTime, referenceTime );
+
+  calls = 0;
+
+}
+
+int main( int argc, char *argv[] ){
+
+  uint32_t rounds = argc > 1 ? atoi( argv[ 1 ] ) : 200;
+  uint32_t count;
+
+  if( rounds == 0 ){
+
+    rounds = 1;
+
+  }
+
+  printf( "Short names:\n" );
+
+  for( count = 16; count <= BENCHMARK_MAX_COMMANDS; count *= 2 ){
+
+    benchmark( count, rounds, false );
+
+  }
+
+  printf( "Names with a common beginning:\n" );
+
+  for( count = 16; count <= BENCHMARK_MAX_COMMANDS; count *= 2 ){
+
+    benchmark( count, rounds, true );
+
+  }
+
+  return 0;
+
+}
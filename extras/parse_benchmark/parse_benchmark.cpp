@@ -0,0 +1,273 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * Benchmark of the argument parsing on a Linux host.
+ *
+ * The same command function is called through the apiBind handler,
+ * that is generated from its parameter list, and through a handler,
+ * that parses the arguments with sscanf like the older examples.
+ * Both handlers check the arguments and print the result.
+ *
+ * The number functions of the library are compared to sscanf and
+ * snprintf of the C library with the same numbers.
+ *
+ * Build and run from the root of the repository:
+ *
+ *   g++ -std=c++11 -O2 -DARDUINO=100 \
+ *       -Iextras/shared_index_stress/host -Isrc \
+ *       src/Commander-API.cpp src/Commander-IO.cpp src/Commander-Arguments.cpp src/Commander-Number.cpp \
+ *       extras/parse_benchmark/parse_benchmark.cpp -o parse_benchmark
+ *   ./parse_benchmark [ rounds ]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+
+#include "Commander-API.hpp"
+
+// The output of the commands is dropped.
+class nullStream : public Stream{
+
+public:
+
+  int    available()          { return 0; }
+  int    read()               { return -1; }
+  int    peek()               { return -1; }
+  size_t write( uint8_t b )   { return 1; }
+
+};
+
+static nullStream out;
+
+// The arguments of the measured command. The handlers
+// modify the argument string, so it is copied every time.
+static const char *arguments = "13 0.75 20000";
+static char argumentBuffer[ 32 ];
+
+// The result is stored, so the calls can not be optimized out.
+static volatile float result = 0.0f;
+
+// The measured command function.
+int32_t set_pwm( uint8_t pin, float duty, int32_t period ){
+
+  result = pin + duty * period;
+  return (int32_t)result;
+
+}
+
+// Generated handler of the set_pwm function.
+static void bind_case(){
+
+  strcpy( argumentBuffer, arguments );
+  commanderBinding< decltype( &set_pwm ), &set_pwm >::handler( argumentBuffer, &out );
+
+}
+
+// Handler with sscanf and the same checks as the generated one.
+static void sscanf_case(){
+
+  int pin;
+  float duty;
+  long period;
+
+  strcpy( argumentBuffer, arguments );
+
+  if( ( sscanf( argumentBuffer, "%d %f %ld", &pin, &duty, &period ) != 3 ) || ( pin < 0 ) || ( pin > 255 ) ){
+
+    out.print( (const char*)"Argument error!" );
+    return;
+
+  }
+
+  out.print( (long)set_pwm( pin, duty, period ) );
+
+}
+
+// The numbers of the parsing and formatting cases.
+static const char *intText = "-1234567";
+static const char *floatText = "3.14159";
+static volatile int32_t intValue = -1234567;
+static volatile float floatValue = 3.14159f;
+static char formatBuffer[ 24 ];
+
+static void parse_int_case(){
+
+  int32_t value;
+
+  commanderParseInt( intText, &value );
+  result = value;
+
+}
+
+static void sscanf_int_case(){
+
+  long value;
+
+  sscanf( intText, "%ld", &value );
+  result = value;
+
+}
+
+static void parse_float_case(){
+
+  float value;
+
+  commanderParseFloat( floatText, &value );
+  result = value;
+
+}
+
+static void sscanf_float_case(){
+
+  float value;
+
+  sscanf( floatText, "%f", &value );
+  result = value;
+
+}
+
+static void format_int_case(){
+
+  commanderFormatInt( formatBuffer, intValue );
+
+}
+
+static void snprintf_int_case(){
+
+  snprintf( formatBuffer, sizeof( formatBuffer ), "%ld", (long)intValue );
+
+}
+
+static void format_float_case(){
+
+  commanderFormatFloat( formatBuffer, floatValue, 2 );
+
+}
+
+static void snprintf_float_case(){
+
+  snprintf( formatBuffer, sizeof( formatBuffer ), "%.2f", floatValue );
+
+}
+
+// The library has to give the same results as the C library.
+static bool check_numbers(){
+
+  char reference[ 24 ];
+  int32_t parsedInt;
+  float parsedFloat;
+
+  if( !commanderParseInt( intText, &parsedInt ) || ( parsedInt != -1234567 ) ){
+
+    return false;
+
+  }
+
+  if( !commanderParseFloat( floatText, &parsedFloat ) || ( parsedFloat != strtof( floatText, NULL ) ) ){
+
+    return false;
+
+  }
+
+  format_int_case();
+  snprintf( reference, sizeof( reference ), "%ld", (long)intValue );
+
+  if( strcmp( formatBuffer, reference ) != 0 ){
+
+    return false;
+
+  }
+
+  format_float_case();
+  snprintf( reference, sizeof( reference ), "%.2f", floatValue );
+
+  return strcmp( formatBuffer, reference ) == 0;
+
+}
+
+// Average time of one call in nanoseconds.
+static double measure( void ( *body )(), uint32_t rounds ){
+
+  std::chrono::steady_clock::time_point start;
+  uint32_t i;
+
+  start = std::chrono::steady_clock::now();
+
+  for( i = 0; i < rounds; i++ ){
+
+    body();
+
+  }
+
+  return std::chrono::duration< double, std::nano >( std::chrono::steady_clock::now() - start ).count() / rounds;
+
+}
+
+// Print the time of a case and its reference.
+static void compare( const char *name, void ( *body )(), void ( *reference )(), const char *referenceName, uint32_t rounds ){
+
+  double time;
+  double referenceTime;
+
+  time = measure( body, rounds );
+  referenceTime = measure( reference, rounds );
+
+  printf( "%-22s %7.1f ns, %-22s %7.1f ns\n", name, time, referenceName, referenceTime );
+
+}
+
+int main( int argc, char *argv[] ){
+
+  uint32_t rounds = argc > 1 ? atoi( argv[ 1 ] ) : 1000000;
+
+  if( rounds == 0 ){
+
+    rounds = 1;
+
+  }
+
+  // Both handlers have to call the function with the same values.
+  result = 0.0f;
+  bind_case();
+
+  if( result != 15013.0f ){
+
+    printf( "FAILED: the apiBind handler did not call the function!\n" );
+    return 1;
+
+  }
+
+  result = 0.0f;
+  sscanf_case();
+
+  if( result != 15013.0f ){
+
+    printf( "FAILED: the sscanf handler did not call the function!\n" );
+    return 1;
+
+  }
+
+  if( !check_numbers() ){
+
+    printf( "FAILED: the number functions differ from the C library!\n" );
+    return 1;
+
+  }
+
+  compare( "apiBind handler", bind_case, sscanf_case, "sscanf handler", rounds );
+  compare( "commanderParseInt", parse_int_case, sscanf_int_case, "sscanf %ld", rounds );
+  compare( "commanderParseFloat", parse_float_case, sscanf_float_case, "sscanf %f", rounds );
+  compare( "commanderFormatInt", format_int_case, snprintf_int_case, "snprintf %ld", rounds );
+  compare( "commanderFormatFloat", format_float_case, snprintf_float_case, "snprintf %.2f", rounds );
+
+  return 0;
+
+}
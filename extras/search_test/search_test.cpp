@@ -0,0 +1,176 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * Regression test of the command search on a Linux host.
+ *
+ * The names are compared by words, the first word is packed in the
+ * index. The names in the trees have the length of one word on 32-bit
+ * and 64-bit platforms, and longer names with the same beginning, so
+ * the comparison of the names without the terminator in the first
+ * word is checked. Every name has to be found with its own function,
+ * and the names that are not in the tree have to be unknown.
+ *
+ * Build and run from the root of the repository:
+ *
+ *   g++ -std=c++11 -O2 -g -DARDUINO=100 \
+ *       -Iextras/shared_index_stress/host -Isrc \
+ *       src/Commander-API.cpp src/Commander-IO.cpp src/Commander-Arguments.cpp src/Commander-Number.cpp \
+ *       extras/search_test/search_test.cpp -o search_test
+ *   ./search_test
+ *
+ * Add -DCOMMANDER_ENABLE_WEIGHTED_SEARCH to test the weighted search too.
+*/
+
+#include <stdio.h>
+#include <string.h>
+
+#include "Commander-API.hpp"
+
+// The output of the commands is dropped.
+class nullStream : public Stream{
+
+public:
+
+  int    available()          { return 0; }
+  int    read()               { return -1; }
+  int    peek()               { return -1; }
+  size_t write( uint8_t b )   { return 1; }
+
+};
+
+// Name of the last called command.
+static const char *lastCalled = NULL;
+
+#define TEST_FUNC( func, name ) void func( char *args, Stream *response ){ lastCalled = name; }
+
+TEST_FUNC( func_0, "abcdefgh" )
+TEST_FUNC( func_1, "abcdefghij" )
+TEST_FUNC( func_2, "abcdefgz" )
+TEST_FUNC( func_3, "wifi" )
+TEST_FUNC( func_4, "wifiScan" )
+TEST_FUNC( func_5, "wifiStat" )
+TEST_FUNC( func_6, "date" )
+TEST_FUNC( func_7, "dateTime" )
+TEST_FUNC( func_8, "abc" )
+TEST_FUNC( func_9, "abcd" )
+
+static Commander::API_t tree[] = {
+  apiElement( "abcdefgh",   "Word length on 64-bit.",  func_0 ),
+  apiElement( "abcdefghij", "Longer, same beginning.", func_1 ),
+  apiElement( "abcdefgz",   "Word length on 64-bit.",  func_2 ),
+  apiElement( "wifi",       "Word length on 32-bit.",  func_3 ),
+  apiElement( "wifiScan",   "Longer, same beginning.", func_4 ),
+  apiElement( "wifiStat",   "Longer, same beginning.", func_5 ),
+  apiElement( "date",       "Word length on 32-bit.",  func_6 ),
+  apiElement( "dateTime",   "Longer, same beginning.", func_7 ),
+  apiElement( "abc",        "Shorter than a word.",    func_8 ),
+  apiElement( "abcd",       "Word length on 32-bit.",  func_9 )
+};
+
+// These names are not in the tree, but they share
+// the beginning with the names of the tree.
+static const char *unknownNames[] = {
+  "abcdefghi", "abcdefg", "abcdefghijk", "abcdefgzz", "wif", "wifiS",
+  "wifiScans", "dat", "dateT", "ab", "abcde", "abcdefghiz"
+};
+
+#define TEST_SIZE( array ) ( sizeof( array ) / sizeof( array[ 0 ] ) )
+
+static int failures = 0;
+
+static void check( bool condition, const char *what, const char *name ){
+
+  if( !condition ){
+
+    printf( "FAILED: %s \"%s\"\n", what, name );
+    failures++;
+
+  }
+
+}
+
+// Every command has to be found and executed, the unknown names not.
+static void check_commander( Commander &commander, const char *mode ){
+
+  nullStream out;
+  uint32_t i;
+
+  printf( "Checking the %s search.\n", mode );
+
+  for( i = 0; i < TEST_SIZE( tree ); i++ ){
+
+    check( commander[ tree[ i ].name ] == &tree[ i ], "lookup", tree[ i ].name );
+
+    lastCalled = NULL;
+    commander.execute( tree[ i ].name, &out );
+    check( ( lastCalled != NULL ) && ( strcmp( lastCalled, tree[ i ].name ) == 0 ), "execute", tree[ i ].name );
+
+  }
+
+  for( i = 0; i < TEST_SIZE( unknownNames ); i++ ){
+
+    check( commander[ unknownNames[ i ] ] == NULL, "unknown lookup", unknownNames[ i ] );
+
+    lastCalled = NULL;
+    commander.execute( unknownNames[ i ], &out );
+    check( lastCalled == NULL, "unknown execute", unknownNames[ i ] );
+
+  }
+
+}
+
+int main(){
+
+  Commander commander;
+
+  commander.attachTree( tree );
+  commander.init();
+
+  check_commander( commander, "binary" );
+
+  #ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+  nullStream out;
+  uint32_t i;
+  uint32_t j;
+
+  if( !commander.enableWeightedSearch() ){
+
+    printf( "FAILED: enableWeightedSearch\n" );
+    return 1;
+
+  }
+
+  // Different weights, so the word length names and their
+  // longer pairs are roots and leaves of the subtrees.
+  for( i = 0; i < TEST_SIZE( tree ); i++ ){
+
+    for( j = 0; j < ( ( i * 7 ) % TEST_SIZE( tree ) ) + 1; j++ ){
+
+      commander.execute( tree[ i ].name, &out );
+
+    }
+
+  }
+
+  commander.rebuildWeightedSearch();
+  check_commander( commander, "weighted" );
+
+  #endif
+
+  if( failures > 0 ){
+
+    printf( "%d failures\n", failures );
+    return 1;
+
+  }
+
+  printf( "Passed.\n" );
+  return 0;
+
+}
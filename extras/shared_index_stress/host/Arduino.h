@@ -0,0 +1,32 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * The parts of the Arduino core, that are used by
+ * the library, for a Linux host build.
+*/
+
+#ifndef COMMANDER_API_EXTRAS_HOST_ARDUINO_H_
+#define COMMANDER_API_EXTRAS_HOST_ARDUINO_H_
+
+#include <chrono>
+
+#include "Stream.h"
+
+class __FlashStringHelper;
+
+#define F( str ) ( str )
+
+inline unsigned long millis(){
+
+  static const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+  return std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::steady_clock::now() - start ).count();
+
+}
+
+#endif /* COMMANDER_API_EXTRAS_HOST_ARDUINO_H_ */
@@ -0,0 +1,120 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * Minimal Print and Stream classes, so the library
+ * can be built on a Linux host without Arduino.
+*/
+
+#ifndef COMMANDER_API_EXTRAS_HOST_STREAM_H_
+#define COMMANDER_API_EXTRAS_HOST_STREAM_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+
+class Print{
+
+public:
+
+  virtual ~Print(){}
+
+  virtual size_t write( uint8_t b ) = 0;
+
+  virtual size_t write( const uint8_t *buffer, size_t size ){
+
+    size_t i;
+
+    for( i = 0; i < size; i++ ){
+      write( buffer[ i ] );
+    }
+
+    return size;
+
+  }
+
+  size_t write( const char *str ){ return write( (const uint8_t*)str, strlen( str ) ); }
+  size_t write( const char *buffer, size_t size ){ return write( (const uint8_t*)buffer, size ); }
+
+  virtual int availableForWrite(){ return 0; }
+
+  size_t print( const char *str ){ return write( str ); }
+  size_t print( char c ){ return write( (uint8_t)c ); }
+  size_t print( int value, int base = 10 ){ return print( (long)value, base ); }
+  size_t print( unsigned int value, int base = 10 ){ return print( (unsigned long)value, base ); }
+
+  size_t print( long value, int base = 10 ){
+
+    char buffer[ 24 ];
+    snprintf( buffer, sizeof( buffer ), base == 16 ? "%lx" : "%ld", value );
+    return print( buffer );
+
+  }
+
+  size_t print( unsigned long value, int base = 10 ){
+
+    char buffer[ 24 ];
+    snprintf( buffer, sizeof( buffer ), base == 16 ? "%lx" : "%lu", value );
+    return print( buffer );
+
+  }
+
+  size_t print( double value, int digits = 2 ){
+
+    char buffer[ 48 ];
+    snprintf( buffer, sizeof( buffer ), "%.*f", digits, value );
+    return print( buffer );
+
+  }
+
+  size_t println(){ return print( "\r\n" ); }
+
+  template< typename T >
+  size_t println( T value ){ return print( value ) + println(); }
+
+  template< typename T >
+  size_t println( T value, int format ){ return print( value, format ) + println(); }
+
+};
+
+class Stream : public Print{
+
+public:
+
+  virtual int available() = 0;
+  virtual int read() = 0;
+  virtual int peek() = 0;
+  virtual void flush(){}
+
+  size_t readBytes( char *buffer, size_t length ){
+
+    size_t count = 0;
+    int c;
+
+    while( count < length ){
+
+      c = read();
+
+      if( c < 0 ){
+        break;
+      }
+
+      buffer[ count ] = (char)c;
+      count++;
+
+    }
+
+    return count;
+
+  }
+
+  size_t readBytes( uint8_t *buffer, size_t length ){ return readBytes( (char*)buffer, length ); }
+
+};
+
+#endif /* COMMANDER_API_EXTRAS_HOST_STREAM_H_ */
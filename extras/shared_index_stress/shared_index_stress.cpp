@@ -0,0 +1,253 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+ *
+ * Stress test of the shared search index on a Linux host.
+ *
+ * Many reader threads execute and search commands with their own
+ * Commander objects, while one writer thread publishes new versions
+ * of the index all the time. Every reader checks, that it sees a
+ * complete version: every command of the tree is found, and it calls
+ * the function of one of the published versions. One more thread
+ * runs the commands as subcommands of a group with the shared index.
+ *
+ * Build and run from the root of the repository:
+ *
+ *   g++ -std=c++11 -O2 -g -pthread -DARDUINO=100 -DCOMMANDER_ENABLE_SHARED_INDEX \
+ *       -Iextras/shared_index_stress/host -Isrc \
+ *       src/Commander-API.cpp src/Commander-IO.cpp src/Commander-Arguments.cpp src/Commander-Number.cpp \
+ *       extras/shared_index_stress/shared_index_stress.cpp -o shared_index_stress
+ *   ./shared_index_stress [ readers ] [ publications ]
+ *
+ * Adding -fsanitize=thread or -fsanitize=address to the flags is recommended.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+#include "Commander-API.hpp"
+
+// Number of commands in one version of the index.
+#define STRESS_COMMAND_COUNT 200
+
+// Length of the generated command names.
+#define STRESS_NAME_SIZE 8
+
+// The output of the commands is dropped.
+class nullStream : public Stream{
+
+public:
+
+  int    available()          { return 0; }
+  int    read()               { return -1; }
+  int    peek()               { return -1; }
+  size_t write( uint8_t b )   { return 1; }
+
+};
+
+// The last called function of the reader thread.
+static thread_local char lastCalled = '\0';
+
+void version_a_func( char *args, Stream *response ){ lastCalled = 'A'; }
+void version_b_func( char *args, Stream *response ){ lastCalled = 'B'; }
+void plugin_func( char *args, Stream *response ){ lastCalled = 'P'; }
+
+// Names of the generated commands.
+static char names[ STRESS_COMMAND_COUNT ][ STRESS_NAME_SIZE ];
+
+// The same names with the functions of the two versions.
+static Commander::API_t treeA[ STRESS_COMMAND_COUNT ];
+static Commander::API_t treeB[ STRESS_COMMAND_COUNT ];
+
+// This command is in every third version only.
+static Commander::API_t pluginTree[] = {
+  apiElement( "plugin", "Plugin command.", plugin_func )
+};
+
+static Commander::sharedIndex_t sharedIndex;
+
+// The group reads the shared index. It is used by the group reader only.
+static Commander groupCommander;
+
+static Commander::API_t groupTree[] = {
+  apiGroup( "group", "Commands of the shared index.", groupCommander )
+};
+
+static std::atomic< bool > stop( false );
+static std::atomic< long > operations( 0 );
+static std::atomic< long > failures( 0 );
+
+// Report a failed check.
+static void check( bool condition, const char *message ){
+
+  if( !condition ){
+
+    if( failures.fetch_add( 1 ) < 10 ){
+      fprintf( stderr, "Failed: %s\n", message );
+    }
+
+  }
+
+}
+
+// Create a version of the index and publish it.
+static bool publish( uint32_t version ){
+
+  Commander::commandTree_t trees[] = {
+    { ( version & 1 ) ? treeB : treeA, STRESS_COMMAND_COUNT },
+    { pluginTree, ( version % 3 ) == 0 ? 1u : 0u }
+  };
+
+  Commander::commandIndex_t newIndex;
+
+  if( !Commander::createIndex( &newIndex, trees, 2 ) ){
+    return false;
+  }
+
+  return Commander::publishIndex( &sharedIndex, &newIndex );
+
+}
+
+static void reader( unsigned int seed ){
+
+  Commander commander;
+  nullStream output;
+
+  char command[ STRESS_NAME_SIZE ];
+  uint32_t first;
+  long count = 0;
+  int i;
+
+  commander.attachSharedIndex( &sharedIndex );
+
+  while( !stop.load() ){
+
+    i = rand_r( &seed ) % STRESS_COMMAND_COUNT;
+    strcpy( command, names[ i ] );
+
+    // Every command is in every version.
+    lastCalled = '\0';
+    commander.execute( command, &output );
+    check( ( lastCalled == 'A' ) || ( lastCalled == 'B' ), "execute" );
+
+    Commander::API_t *element = commander[ command ];
+    check( ( element != NULL ) && ( strcmp( element -> name, command ) == 0 ), "element by name" );
+
+    // The plugin comes and goes, but it is never half-published.
+    lastCalled = '\0';
+    commander.execute( "plugin", &output );
+    check( ( lastCalled == 'P' ) || ( lastCalled == '\0' ), "plugin" );
+
+    // There are 100 commands with this prefix in every version.
+    check( commander.findIndexPrefix( "c1", &first ) == 100, "prefix" );
+
+    if( ( count & 255 ) == 0 ){
+      commander.printHelp( &output );
+    }
+
+    count++;
+
+  }
+
+  operations.fetch_add( count );
+
+}
+
+// The subcommands are searched in the shared index by the group.
+static void group_reader( unsigned int seed ){
+
+  Commander commander;
+  nullStream output;
+
+  char command[ STRESS_NAME_SIZE + 6 ];
+  long count = 0;
+
+  commander.attachTree( groupTree );
+  commander.init();
+
+  groupCommander.attachSharedIndex( &sharedIndex );
+
+  while( !stop.load() ){
+
+    snprintf( command, sizeof( command ), "group %s", names[ rand_r( &seed ) % STRESS_COMMAND_COUNT ] );
+
+    lastCalled = '\0';
+    commander.execute( command, &output );
+    check( ( lastCalled == 'A' ) || ( lastCalled == 'B' ), "group execute" );
+
+    count++;
+
+  }
+
+  operations.fetch_add( count );
+
+}
+
+int main( int argc, char *argv[] ){
+
+  int readerCount = argc > 1 ? atoi( argv[ 1 ] ) : 8;
+  int publications = argc > 2 ? atoi( argv[ 2 ] ) : 500;
+  int i;
+
+  std::vector< std::thread > readers;
+
+  for( i = 0; i < STRESS_COMMAND_COUNT; i++ ){
+
+    snprintf( names[ i ], STRESS_NAME_SIZE, "c%03d", i );
+    treeA[ i ] = (Commander::API_t)apiElement( names[ i ], "Version A.", version_a_func );
+    treeB[ i ] = (Commander::API_t)apiElement( names[ i ], "Version B.", version_b_func );
+
+  }
+
+  if( !publish( 0 ) ){
+
+    fprintf( stderr, "Not enough memory for the index!\n" );
+    return 1;
+
+  }
+
+  for( i = 0; i < readerCount; i++ ){
+    readers.push_back( std::thread( reader, (unsigned int)i ) );
+  }
+
+  readers.push_back( std::thread( group_reader, (unsigned int)readerCount ) );
+
+  // The writer thread publishes the new versions.
+  std::thread writer( [ publications ](){
+
+    int version;
+
+    for( version = 1; version <= publications; version++ ){
+
+      check( publish( version ), "publish" );
+      std::this_thread::sleep_for( std::chrono::microseconds( 100 ) );
+
+    }
+
+    stop.store( true );
+
+  } );
+
+  writer.join();
+
+  for( i = 0; i < (int)readers.size(); i++ ){
+    readers[ i ].join();
+  }
+
+  // Release the last version.
+  Commander::publishIndex( &sharedIndex, NULL );
+
+  printf( "%d readers, %d publications, %ld reader iterations, %ld failures\n", readerCount, publications, operations.load(), failures.load() );
+
+  return failures.load() == 0 ? 0 : 1;
+
+}
@@ -84,14 +84,12 @@ void commander_uptime_func( char *args, Stream *response ){
 
 void commander_pinMode_func( char *args, Stream *response ){
 
-  int pin;
-  int direction;
+  commanderArgs arguments( args );
 
-  int argResult;
+  int32_t pin;
+  int32_t direction;
 
-  argResult = sscanf( args, "%d %d", &pin, &direction );
-
-  if( argResult != 2 ){
+  if( ( arguments.count() != 2 ) || !arguments.getInt( 0, &pin ) || !arguments.getInt( 1, &direction ) ){
 
     #ifdef __AVR__
     response -> print( F( "Argument error!" ) );
@@ -141,14 +139,12 @@ void commander_pinMode_func( char *args, Stream *response ){
 
 void commander_digitalWrite_func( char *args, Stream *response ){
 
-  int pin;
-  int state;
-
-  int argResult;
+  commanderArgs arguments( args );
 
-  argResult = sscanf( args, "%d %d", &pin, &state );
+  int32_t pin;
+  int32_t state;
 
-  if( argResult != 2 ){
+  if( ( arguments.count() != 2 ) || !arguments.getInt( 0, &pin ) || !arguments.getInt( 1, &state ) ){
 
     #ifdef __AVR__
     response -> print( F( "Argument error!" ) );
@@ -198,13 +194,11 @@ void commander_digitalWrite_func( char *args, Stream *response ){
 
 void commander_digitalRead_func( char *args, Stream *response ){
 
-  int pin;
+  commanderArgs arguments( args );
 
-  int argResult;
+  int32_t pin;
 
-  argResult = sscanf( args, "%d", &pin );
-
-  if( argResult != 1 ){
+  if( ( arguments.count() != 1 ) || !arguments.getInt( 0, &pin ) ){
 
     #ifdef __AVR__
     response -> print( F( "Argument error!" ) );
@@ -236,13 +230,11 @@ void commander_digitalRead_func( char *args, Stream *response ){
 
 void commander_analogRead_func( char *args, Stream *response ){
 
-  int pin;
-
-  int argResult;
+  commanderArgs arguments( args );
 
-  argResult = sscanf( args, "%d", &pin );
+  int32_t pin;
 
-  if( argResult != 1 ){
+  if( ( arguments.count() != 1 ) || !arguments.getInt( 0, &pin ) ){
 
     response -> print( F( "Argument error!" ) );
     return;
@@ -291,13 +283,11 @@ void commander_analogRead_func( char *args, Stream *response ){
 
 void commander_analogRead_func( char *args, Stream *response ){
 
-  int pin;
+  commanderArgs arguments( args );
 
-  int argResult;
+  int32_t pin;
 
-  argResult = sscanf( args, "%d", &pin );
-
-  if( argResult != 1 ){
+  if( ( arguments.count() != 1 ) || !arguments.getInt( 0, &pin ) ){
 
     response -> print( F( "Argument error!" ) );
     return;
@@ -370,13 +360,11 @@ void commander_analogRead_func( char *args, Stream *response ){
 
 void commander_analogRead_func( char *args, Stream *response ){
 
-  int pin;
-
-  int argResult;
+  commanderArgs arguments( args );
 
-  argResult = sscanf( args, "%d", &pin );
+  int32_t pin;
 
-  if( argResult != 1 ){
+  if( ( arguments.count() != 1 ) || !arguments.getInt( 0, &pin ) ){
 
     response -> print( (const char*)"Argument error!" );
     return;
@@ -530,35 +518,39 @@ void commander_wifiScan_func( char *args, Stream *response ){
 
 void commander_configTime_func( char *args, Stream *response ){
 
-  int gmtOffset_sec;
-  int daylightOffset_sec;
-  char ntpServer[32] = "";
-  int argResult;
+  commanderArgs arguments( args );
 
-  argResult = sscanf( args, "%d %d %s", &gmtOffset_sec, &daylightOffset_sec, ntpServer );
+  int32_t gmtOffset_sec;
+  int32_t daylightOffset_sec;
 
-  if( argResult == 3 ){
+  // Only the two offsets and the server are accepted. The extra
+  // arguments and the unclosed quotes are reported, nothing is
+  // configured from them.
+  if( !arguments.isValid() || ( arguments.count() < 2 ) || ( arguments.count() > 3 ) ){
 
-    configTime( gmtOffset_sec, daylightOffset_sec, ntpServer );
-    response -> print( (const char*)"Time configured." );
+    response -> print( (const char*)"Argument error!" );
     return;
 
   }
 
-  argResult = sscanf( args, "%d %d", &gmtOffset_sec, &daylightOffset_sec );
+  if( !arguments.getInt( 0, &gmtOffset_sec ) || !arguments.getInt( 1, &daylightOffset_sec ) ){
 
-  if( argResult == 2 ){
-
-    configTime( gmtOffset_sec, daylightOffset_sec, (const char*)"pool.ntp.org" );
-    response -> print( (const char*)"Time configured with default NTP server: pool.ntp.org" );
+    response -> print( (const char*)"Argument error!" );
     return;
 
   }
 
+  if( arguments.count() == 3 ){
+
+    configTime( gmtOffset_sec, daylightOffset_sec, arguments.getString( 2 ) );
+    response -> print( (const char*)"Time configured." );
+
+  }
+
   else{
 
-    response -> print( (const char*)"Argument error!" );
-    return;
+    configTime( gmtOffset_sec, daylightOffset_sec, (const char*)"pool.ntp.org" );
+    response -> print( (const char*)"Time configured with default NTP server: pool.ntp.org" );
 
   }
 
@@ -822,28 +814,55 @@ void commander_reboot_func( char *args, Stream *response ){
 
 void commander_sin_func( char *args, Stream *response ){
 
-  float f = atof( args );
+  commanderArgs arguments( args );
+
+  float f;
+
+  if( ( arguments.count() != 1 ) || !arguments.getFloat( 0, &f ) ){
+
+    #ifdef __AVR__
+    response -> print( F( "Argument error!" ) );
+    #else
+    response -> print( (const char*)"Argument error!" );
+    #endif
+
+    return;
+
+  }
 
-  response -> print( sin( f ), 6 );
+  commanderPrintFloat( response, sin( f ), 6 );
 
 }
 
 void commander_cos_func( char *args, Stream *response ){
 
-  float f = atof( args );
+  commanderArgs arguments( args );
 
-  response -> print( cos( f ), 6 );
+  float f;
+
+  if( ( arguments.count() != 1 ) || !arguments.getFloat( 0, &f ) ){
+
+    #ifdef __AVR__
+    response -> print( F( "Argument error!" ) );
+    #else
+    response -> print( (const char*)"Argument error!" );
+    #endif
+
+    return;
+
+  }
+
+  commanderPrintFloat( response, cos( f ), 6 );
 
 }
 
 void commander_not_func( char *args, Stream *response ){
 
-  int num;
-  int argResult;
+  commanderArgs arguments( args );
 
-  argResult = sscanf( args, "%d", &num );
+  int32_t num;
 
-  if( argResult != 1 ){
+  if( ( arguments.count() != 1 ) || !arguments.getInt( 0, &num ) ){
 
     #ifdef __AVR__
     response -> print( F( "Argument error!" ) );
@@ -855,19 +874,18 @@ void commander_not_func( char *args, Stream *response ){
 
   }
 
-  response -> print( !num );
+  commanderPrintInt( response, !num );
 
 }
 
 void commander_random_func( char *args, Stream *response ){
 
-  int min;
-  int max;
-  int argResult;
+  commanderArgs arguments( args );
 
-  argResult = sscanf( args, "%d %d", &min, &max );
+  int32_t min;
+  int32_t max;
 
-  if( argResult != 2 ){
+  if( ( arguments.count() != 2 ) || !arguments.getInt( 0, &min ) || !arguments.getInt( 1, &max ) ){
 
     #ifdef __AVR__
     response -> print( F( "Argument error!" ) );
@@ -891,14 +909,28 @@ void commander_random_func( char *args, Stream *response ){
 
   }
 
-  response -> print( random( min, max ) );
+  commanderPrintInt( response, random( min, max ) );
 
 }
 
 void commander_abs_func( char *args, Stream *response ){
 
-  float f = atof( args );
+  commanderArgs arguments( args );
+
+  float f;
+
+  if( ( arguments.count() != 1 ) || !arguments.getFloat( 0, &f ) ){
+
+    #ifdef __AVR__
+    response -> print( F( "Argument error!" ) );
+    #else
+    response -> print( (const char*)"Argument error!" );
+    #endif
+
+    return;
+
+  }
 
-  response -> print( abs( f ) );
+  commanderPrintFloat( response, abs( f ) );
 
 }
@@ -64,27 +64,27 @@ void commander_reboot_func( char *args, Stream *response );
 
 //-------- Timing functions --------//
 
-#define API_ELEMENT_MICROS apiElement( "micros", "Returns the number of microseconds passed since the program started.", commander_micros_func )
+#define API_ELEMENT_MICROS apiElement( "micros", COMMANDER_DICT_RETURNS "number of microseconds" COMMANDER_DICT_SINCE_START, commander_micros_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_MICROS( element ) apiElement_P( element, "micros", "Returns the number of microseconds passed since the program started.", commander_micros_func )
+  #define API_ELEMENT_P_MICROS( element ) apiElement_P( element, "micros", COMMANDER_DICT_RETURNS "number of microseconds" COMMANDER_DICT_SINCE_START, commander_micros_func )
 #endif
 /// Premade function for micros command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_micros_func( char *args, Stream *response );
 
-#define API_ELEMENT_MILLIS apiElement( "millis", "Returns the number of milliseconds passed since the program started.", commander_millis_func )
+#define API_ELEMENT_MILLIS apiElement( "millis", COMMANDER_DICT_RETURNS "number of milliseconds" COMMANDER_DICT_SINCE_START, commander_millis_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_MILLIS( element ) apiElement_P( element, "millis", "Returns the number of milliseconds passed since the program started.", commander_millis_func )
+  #define API_ELEMENT_P_MILLIS( element ) apiElement_P( element, "millis", COMMANDER_DICT_RETURNS "number of milliseconds" COMMANDER_DICT_SINCE_START, commander_millis_func )
 #endif
 /// Premade function for millis command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_millis_func( char *args, Stream *response );
 
-#define API_ELEMENT_UPTIME apiElement( "uptime", "Returns the time passed since the program started.", commander_uptime_func )
+#define API_ELEMENT_UPTIME apiElement( "uptime", COMMANDER_DICT_RETURNS "time" COMMANDER_DICT_SINCE_START, commander_uptime_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_UPTIME( element ) apiElement_P( element, "uptime", "Returns the time passed since the program started.", commander_uptime_func )
+  #define API_ELEMENT_P_UPTIME( element ) apiElement_P( element, "uptime", COMMANDER_DICT_RETURNS "time" COMMANDER_DICT_SINCE_START, commander_uptime_func )
 #endif
 /// Premade function for uptime command.
 /// @param args Pointer to the argument string.
@@ -93,9 +93,9 @@ void commander_uptime_func( char *args, Stream *response );
 
 //-------- Pure awesomeness --------//
 
-#define API_ELEMENT_NEOFETCH apiElement( "neofetch", "Nice looking system information.", commander_neofetch_func )
+#define API_ELEMENT_NEOFETCH apiElement( "neofetch", "Nice looking system" COMMANDER_DICT_INFORMATION, commander_neofetch_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_NEOFETCH( element ) apiElement_P( element, "neofetch", "Nice looking system information.", commander_neofetch_func )
+  #define API_ELEMENT_P_NEOFETCH( element ) apiElement_P( element, "neofetch", "Nice looking system" COMMANDER_DICT_INFORMATION, commander_neofetch_func )
 #endif
 /// Premade function for neofetch command.
 /// @param args Pointer to the argument string.
@@ -106,27 +106,27 @@ void commander_neofetch_func( char *args, Stream *response );
 
 //-------- Digital I-O functions --------//
 
-#define API_ELEMENT_PINMODE apiElement( "pinMode", "Set the direction of a pin.\r\n\tExample: pinMode [ Pin Number ] [ Direction ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ Direction ] - 0 means input, 1 means output.", commander_pinMode_func )
+#define API_ELEMENT_PINMODE apiElement( "pinMode", "Set the direction of a pin." COMMANDER_DICT_EXAMPLE "pinMode" COMMANDER_DICT_PIN_NUMBER " [ Direction ]" COMMANDER_DICT_PIN_NUMBER_HELP "\r\n\t[ Direction ] - 0 means input, 1 means output.", commander_pinMode_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_PINMODE( element ) apiElement_P( element, "pinMode", "Set the direction of a pin.\r\n\tExample: pinMode [ Pin Number ] [ Direction ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ Direction ] - 0 means input, 1 means output.", commander_pinMode_func )
+  #define API_ELEMENT_P_PINMODE( element ) apiElement_P( element, "pinMode", "Set the direction of a pin." COMMANDER_DICT_EXAMPLE "pinMode" COMMANDER_DICT_PIN_NUMBER " [ Direction ]" COMMANDER_DICT_PIN_NUMBER_HELP "\r\n\t[ Direction ] - 0 means input, 1 means output.", commander_pinMode_func )
 #endif
 /// Premade function for pinMode command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_pinMode_func( char *args, Stream *response );
 
-#define API_ELEMENT_DIGITALWRITE apiElement( "digitalWrite", "Set the state of an output pin.\r\n\tExample: digitalWrite [ Pin Number ] [ State ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ State ] - 0 means low, 1 means high.", commander_digitalWrite_func )
+#define API_ELEMENT_DIGITALWRITE apiElement( "digitalWrite", "Set" COMMANDER_DICT_STATE "an output pin." COMMANDER_DICT_EXAMPLE "digitalWrite" COMMANDER_DICT_PIN_NUMBER " [ State ]" COMMANDER_DICT_PIN_NUMBER_HELP "\r\n\t[ State ] - " COMMANDER_DICT_LOW_HIGH, commander_digitalWrite_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_DIGITALWRITE( element ) apiElement_P( element, "digitalWrite", "Set the state of an output pin.\r\n\tExample: digitalWrite [ Pin Number ] [ State ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ State ] - 0 means low, 1 means high.", commander_digitalWrite_func )
+  #define API_ELEMENT_P_DIGITALWRITE( element ) apiElement_P( element, "digitalWrite", "Set" COMMANDER_DICT_STATE "an output pin." COMMANDER_DICT_EXAMPLE "digitalWrite" COMMANDER_DICT_PIN_NUMBER " [ State ]" COMMANDER_DICT_PIN_NUMBER_HELP "\r\n\t[ State ] - " COMMANDER_DICT_LOW_HIGH, commander_digitalWrite_func )
 #endif
 /// Premade function for digitalWrite command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_digitalWrite_func( char *args, Stream *response );
 
-#define API_ELEMENT_DIGITALREAD apiElement( "digitalRead", "Read the state of a pin.\r\n\tExample: digitalRead [ Pin Number ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ Returns ] - 0 means low, 1 means high.", commander_digitalRead_func )
+#define API_ELEMENT_DIGITALREAD apiElement( "digitalRead", "Read" COMMANDER_DICT_STATE "a pin." COMMANDER_DICT_EXAMPLE "digitalRead" COMMANDER_DICT_PIN_NUMBER COMMANDER_DICT_PIN_NUMBER_HELP COMMANDER_DICT_RETURNS_HELP COMMANDER_DICT_LOW_HIGH, commander_digitalRead_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_DIGITALREAD( element ) apiElement_P( element, "digitalRead", "Read the state of a pin.\r\n\tExample: digitalRead [ Pin Number ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ Returns ] - 0 means low, 1 means high.", commander_digitalRead_func )
+  #define API_ELEMENT_P_DIGITALREAD( element ) apiElement_P( element, "digitalRead", "Read" COMMANDER_DICT_STATE "a pin." COMMANDER_DICT_EXAMPLE "digitalRead" COMMANDER_DICT_PIN_NUMBER COMMANDER_DICT_PIN_NUMBER_HELP COMMANDER_DICT_RETURNS_HELP COMMANDER_DICT_LOW_HIGH, commander_digitalRead_func )
 #endif
 /// Premade function for digitalRead command.
 /// @param args Pointer to the argument string.
@@ -135,9 +135,9 @@ void commander_digitalRead_func( char *args, Stream *response );
 
 //-------- Analog I-O functions --------//
 
-#define API_ELEMENT_ANALOGREAD apiElement( "analogRead", "Generate an ADC measurement on a pin.\r\n\tExample: analogRead [ Pin Number ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ Returns ] - The raw ADC sample.", commander_analogRead_func )
+#define API_ELEMENT_ANALOGREAD apiElement( "analogRead", "Generate an ADC measurement on a pin." COMMANDER_DICT_EXAMPLE "analogRead" COMMANDER_DICT_PIN_NUMBER COMMANDER_DICT_PIN_NUMBER_HELP COMMANDER_DICT_RETURNS_HELP "The raw ADC sample.", commander_analogRead_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_ANALOGREAD( element ) apiElement_P( element, "analogRead", "Generate an ADC measurement on a pin.\r\n\tExample: analogRead [ Pin Number ]\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board.\r\n\t[ Returns ] - The raw ADC sample.", commander_analogRead_func )
+  #define API_ELEMENT_P_ANALOGREAD( element ) apiElement_P( element, "analogRead", "Generate an ADC measurement on a pin." COMMANDER_DICT_EXAMPLE "analogRead" COMMANDER_DICT_PIN_NUMBER COMMANDER_DICT_PIN_NUMBER_HELP COMMANDER_DICT_RETURNS_HELP "The raw ADC sample.", commander_analogRead_func )
 #endif
 /// Premade function for analogRead command.
 /// @param args Pointer to the argument string.
@@ -148,13 +148,13 @@ void commander_analogRead_func( char *args, Stream *response );
 
 #if defined( ESP32 ) || ( ESP8266 )
 
-#define API_ELEMENT_IPCONFIG apiElement( "ipconfig", "Print network information.", commander_ipconfig_func )
+#define API_ELEMENT_IPCONFIG apiElement( "ipconfig", "Print network" COMMANDER_DICT_INFORMATION, commander_ipconfig_func )
 /// Premade function for ipconfig command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_ipconfig_func( char *args, Stream *response );
 
-#define API_ELEMENT_WIFISTAT apiElement( "wifiStat", "Print WiFi information.", commander_wifiStat_func )
+#define API_ELEMENT_WIFISTAT apiElement( "wifiStat", "Print WiFi" COMMANDER_DICT_INFORMATION, commander_wifiStat_func )
 /// Premade function for wifiStat command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
@@ -170,13 +170,13 @@ void commander_wifiScan_func( char *args, Stream *response );
 
 #ifdef ESP32
 
-#define API_ELEMENT_CONFIGTIME apiElement( "configTime", "Configure NTP time settings.\r\n\tExample: configTime [ GMT Offset Sec ] [ DL Offset Sec ] [ Server ]\r\n\t[ GMT Offset Sec ] - UTC offset for your timezone in seconds.\r\n\t[ GMT Offset Sec ] - Daylight offset in sec.\r\n\t[ Server ] - NTP Server Address( optional, default: pool.ntp.org )", commander_configTime_func )
+#define API_ELEMENT_CONFIGTIME apiElement( "configTime", "Configure NTP time settings." COMMANDER_DICT_EXAMPLE "configTime [ GMT" COMMANDER_DICT_OFFSET_SEC " [ DL" COMMANDER_DICT_OFFSET_SEC " [ Server ]\r\n\t[ GMT" COMMANDER_DICT_OFFSET_SEC " - UTC offset for your timezone in seconds.\r\n\t[ GMT" COMMANDER_DICT_OFFSET_SEC " - Daylight offset in sec.\r\n\t[ Server ] - NTP Server Address( optional, default: pool.ntp.org )", commander_configTime_func )
 /// Premade function for wifiScan command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_configTime_func( char *args, Stream *response );
 
-#define API_ELEMENT_DATETIME apiElement( "dateTime", "Returns the NTP synchronised date and time.", commander_dateTime_func )
+#define API_ELEMENT_DATETIME apiElement( "dateTime", COMMANDER_DICT_RETURNS "NTP synchronised date and time.", commander_dateTime_func )
 /// Premade function for wifiScan command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
@@ -186,36 +186,36 @@ void commander_dateTime_func( char *args, Stream *response );
 
 //-------- Math functions --------//
 
-#define API_ELEMENT_SIN apiElement( "sin", "Sine function. The input is in radians.", commander_sin_func )
+#define API_ELEMENT_SIN apiElement( "sin", "Sine" COMMANDER_DICT_RADIANS, commander_sin_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_SIN( element ) apiElement_P( element, "sin", "Sine function. The input is in radians.", commander_sin_func )
+  #define API_ELEMENT_P_SIN( element ) apiElement_P( element, "sin", "Sine" COMMANDER_DICT_RADIANS, commander_sin_func )
 #endif
 /// Premade function for sin command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_sin_func( char *args, Stream *response );
 
-#define API_ELEMENT_COS apiElement( "cos", "Cosine function. The input is in radians.", commander_cos_func )
+#define API_ELEMENT_COS apiElement( "cos", "Cosine" COMMANDER_DICT_RADIANS, commander_cos_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_COS( element ) apiElement_P( element, "cos", "Cosine function. The input is in radians.", commander_cos_func )
+  #define API_ELEMENT_P_COS( element ) apiElement_P( element, "cos", "Cosine" COMMANDER_DICT_RADIANS, commander_cos_func )
 #endif
 /// Premade function for cos command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_cos_func( char *args, Stream *response );
 
-#define API_ELEMENT_ABS apiElement( "abs", "Calculates the absolute value of a number.", commander_abs_func )
+#define API_ELEMENT_ABS apiElement( "abs", "Calculates the absolute value of a" COMMANDER_DICT_NUMBER ".", commander_abs_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_ABS( element ) apiElement_P( element, "abs", "Calculates the absolute value of a number.", commander_abs_func )
+  #define API_ELEMENT_P_ABS( element ) apiElement_P( element, "abs", "Calculates the absolute value of a" COMMANDER_DICT_NUMBER ".", commander_abs_func )
 #endif
 /// Premade function for abs command.
 /// @param args Pointer to the argument string.
 /// @param response Response channel for messages.
 void commander_abs_func( char *args, Stream *response );
 
-#define API_ELEMENT_RANDOM apiElement( "random", "Generates a random number between the parameters.\r\n\tExample: random [ min ] [ max ]\r\n\t[ min ] - Lower integer bound\r\n\t[ max ] - Upper integer bound", commander_random_func )
+#define API_ELEMENT_RANDOM apiElement( "random", "Generates a random" COMMANDER_DICT_NUMBER " between the parameters." COMMANDER_DICT_EXAMPLE "random [ min ] [ max ]\r\n\t[ min ] - Lower" COMMANDER_DICT_INTEGER_BOUND "\r\n\t[ max ] - Upper" COMMANDER_DICT_INTEGER_BOUND, commander_random_func )
 #ifdef __AVR__
-  #define API_ELEMENT_P_RANDOM( element ) apiElement_P( element, "random", "Generates a random number between the parameters.\r\n\tExample: random [ min ] [ max ]\r\n\t[ min ] - Lower integer bound\r\n\t[ max ] - Upper integer bound", commander_random_func )
+  #define API_ELEMENT_P_RANDOM( element ) apiElement_P( element, "random", "Generates a random" COMMANDER_DICT_NUMBER " between the parameters." COMMANDER_DICT_EXAMPLE "random [ min ] [ max ]\r\n\t[ min ] - Lower" COMMANDER_DICT_INTEGER_BOUND "\r\n\t[ max ] - Upper" COMMANDER_DICT_INTEGER_BOUND, commander_random_func )
 #endif
 /// Premade function for random command.
 /// @param args Pointer to the argument string.
@@ -33,47 +33,53 @@ SOFTWARE.
 
 
 #include "Commander-API.hpp"
+#include "Commander-Hash.hpp"
 
-const char *Commander::version = COMMANDER_API_VERSION;
+const char *CommanderCore::version = COMMANDER_API_VERSION;
 
-void Commander::attachTreeFunction( API_t *API_tree_p, uint32_t API_tree_size_p ){
+void CommanderCore::attachTreeFunction( const API_t *API_tree_p, uint32_t API_tree_size_p ){
 
-	// Save parameters to internal variables.
-	API_tree      = API_tree_p;
-	API_tree_size = API_tree_size_p;
+	// The new tree replaces all of the attached trees.
+	treeCount = 0;
 
-	#if defined( ARDUINO ) && defined( __AVR__ )
+	appendTreeFunction( API_tree_p, API_tree_size_p );
 
-	dbgResponse -> print( F( "API tree attached with " ) );
-	dbgResponse -> print( API_tree_size );
-	dbgResponse -> println( F( " commands." ) );
+}
 
-	#else
+bool CommanderCore::appendTreeFunction( const API_t *API_tree_p, uint32_t API_tree_size_p ){
 
-	dbgResponse -> print( (const char*)"API tree attached with "  );
-	dbgResponse -> print( API_tree_size );
-	dbgResponse -> println( " commands." );
+	if( treeCount >= COMMANDER_MAX_ATTACHED_TREES ){
 
-	#endif
+		#if defined( ARDUINO ) && defined( __AVR__ )
 
-}
+		dbgResponse -> println( F( "Too many API trees attached!" ) );
+
+		#else
 
-void Commander::init(){
+		dbgResponse -> println( (const char*)"Too many API trees attached!" );
 
-	// Generic conter variables.
-	uint32_t i;
-	uint32_t  j;
+		#endif
 
-	// Temporary variable, used to flip elements.
-	API_t temp;
+		return false;
 
-	#ifdef __AVR__
+	}
+
+	// Save parameters to internal variables.
+	trees[ treeCount ].tree = API_tree_p;
+	trees[ treeCount ].size = API_tree_size_p;
+	treeCount++;
+
+	#ifdef COMMANDER_ENABLE_HASH_TABLE
 
-	if( API_tree[ 0 ].name == NULL ){
+	// The regular tree replaces the hash table. The index of the
+	// table can not be used without the hash, so it is emptied
+	// until the init function creates the new one.
+	if( hashSlots != NULL ){
 
-		memoryType = MEMORY_PROGMEM;
-		commander_strcmp = &Commander::commander_strcmp_progmem;
-		commander_strcmp_tree_ram = &Commander::commander_strcmp_tree_ram_progmem;
+		hashSeeds = NULL;
+		hashSlots = NULL;
+		index.size = 0;
+		commands_changed();
 
 	}
 
@@ -81,81 +87,98 @@ void Commander::init(){
 
 	#if defined( ARDUINO ) && defined( __AVR__ )
 
-	dbgResponse -> println( F( "Commander init start" ) );
+	dbgResponse -> print( F( "API tree attached with " ) );
+	dbgResponse -> print( API_tree_size_p );
+	dbgResponse -> println( F( " commands." ) );
 
 	#else
 
-	dbgResponse -> println( (const char*)"Commander init start" );
+	dbgResponse -> print( (const char*)"API tree attached with "  );
+	dbgResponse -> print( API_tree_size_p );
+	dbgResponse -> println( " commands." );
 
 	#endif
 
-	// Make the tree ordered by alphabet.
-	#if defined( ARDUINO ) && defined( __AVR__ )
+	return true;
 
-	dbgResponse -> print( F( "\tCreating alphabetical order... " ) );
+}
 
-	#else
+void CommanderCore::init(){
 
-	dbgResponse -> print( (const char*)"\tCreating alphabetical order... " );
+	#ifdef COMMANDER_ENABLE_HASH_TABLE
 
-	#endif
+	// The hash table is generated at compile time and it is
+	// stored in read only memory, so it must not be modified.
+	if( hashSlots != NULL ){
 
-	for( i = 0; i < API_tree_size; i++ ){
+		#if defined( ARDUINO ) && defined( __AVR__ )
 
-		for( j = i + 1; j < API_tree_size; j++ ){
+		dbgResponse -> println( F( "Commander uses compile time hash table, nothing to init." ) );
 
-			if( ( this ->* commander_strcmp )( &API_tree[ i ], &API_tree[ j ] ) > 0 ){
+		#else
 
-				temp = API_tree[ i ];
-				API_tree[ i ] = API_tree[ j ];
-				API_tree[ j ] = temp;
+		dbgResponse -> println( (const char*)"Commander uses compile time hash table, nothing to init." );
 
-			}
+		#endif
 
-		}
+		return;
 
 	}
 
-	// Fill the place variable in the tree with
-	// correct alphabetical place.
-	for( i = 0; i < API_tree_size; i++ ){
-
-		API_tree[ i ].place = i;
+	#endif
 
-	}
+	// The new index is created before the old one is released.
+	commandIndex_t newIndex;
 
 	#if defined( ARDUINO ) && defined( __AVR__ )
 
-	dbgResponse -> println( F( "[ OK ]" ) );
+	dbgResponse -> println( F( "Commander init start" ) );
 
 	#else
 
-	dbgResponse -> println( (const char*)"[ OK ]" );
+	dbgResponse -> println( (const char*)"Commander init start" );
 
 	#endif
 
-
-	// Optimize the tree to make it balanced.
+	// Create the search index in alphabetical order.
 	// It is necessary to speed up the command
-	// search phase.
-	#if defined( ARDUINO ) && defined( __AVR__ )
+	// search phase. The API-trees are not modified.
+	// The duplicated commands are reported before
+	// the result of the step.
+	if( !createIndex( &newIndex, trees, treeCount, aliasTable, aliasTableSize, dbgResponse ) ){
+
+		#if defined( ARDUINO ) && defined( __AVR__ )
 
-	dbgResponse -> print( F( "\tCreate balanced binary structure... " ) );
+		dbgResponse -> print( F( "\tCreate search index... " ) );
+		dbgResponse -> println( F( "[ FAILED ]" ) );
+		dbgResponse -> println( F( "Not enough memory for the search index!" ) );
 
-	#else
+		#else
 
-	dbgResponse -> print( (const char*)"\tCreate balanced binary structure... " );
+		dbgResponse -> print( (const char*)"\tCreate search index... " );
+		dbgResponse -> println( (const char*)"[ FAILED ]" );
+		dbgResponse -> println( (const char*)"Not enough memory for the search index!" );
 
-	#endif
-	optimize_api_tree();
+		#endif
+
+		return;
+
+	}
+
+	attachIndex( &newIndex );
+
+	// The index is created by this object, so it has to release it.
+	indexOwned = true;
 
 	#if defined( ARDUINO ) && defined( __AVR__ )
 
+	dbgResponse -> print( F( "\tCreate search index... " ) );
 	dbgResponse -> println( F( "[ OK ]" ) );
 	dbgResponse -> println( F( "Commander init finished!" ) );
 
 	#else
 
+	dbgResponse -> print( (const char*)"\tCreate search index... " );
 	dbgResponse -> println( (const char*)"[ OK ]" );
 	dbgResponse -> println( (const char*)"Commander init finished!" );
 
@@ -163,625 +186,4211 @@ void Commander::init(){
 
 }
 
-uint16_t Commander::find_api_index_by_place( uint16_t place ){
-
-	// Generic counter variable
-	uint16_t i;
+CommanderCore::CommanderCore( char *commandBuffer_p, uint32_t commandSize_p, char *argumentBuffer_p, uint32_t argumentSize_p, uint8_t *pipeBuffer_p, uint32_t pipeSize_p, lineState_t *line_p, char *lineBuffer_p, uint32_t lineSize_p ){
 
-	// Go through all commands
-	for( i = 0; i < API_tree_size; i++ ){
+	tempBuff = commandBuffer_p;
+	commandSize = commandSize_p;
 
-		// Check that if we found the desired command
-		if( API_tree[i].place == place ){
+	line = line_p;
 
-			// If we found it, return the index of it.
-			return i;
+	if( line != NULL ){
 
-		}
+		line -> buffer = lineBuffer_p;
+		line -> size = lineSize_p;
+		line -> length = 0;
+		line -> checked = 0;
+		line -> discard = false;
+		line -> policy = OVERFLOW_DISCARD;
 
 	}
 
-	return 0;
+	#ifdef COMMANDER_ENABLE_PIPE_MODULE
 
-}
+	pipeArgBuffer = argumentBuffer_p;
+	argumentSize = argumentSize_p;
+	pipeChannel.begin( pipeBuffer_p, pipeSize_p );
 
-void Commander::swap_api_elements( uint16_t index, uint16_t place ){
+	#else
 
-  // Buffer that will temporary hold an element.
-  // This is required for a swap.
-  API_t buffer;
+	( void )argumentBuffer_p;
+	( void )argumentSize_p;
+	( void )pipeBuffer_p;
+	( void )pipeSize_p;
 
-  // This variable will store the address of the element defined by the second argument( place ).
-  uint16_t current_index;
+	#endif
 
-  // Find the index in the array by place of the 'i'-th element
-  current_index = find_api_index_by_place( place );
+}
 
-  // save the context of the 'i'-th element to the buffer
-  buffer = API_tree[index];
+CommanderCore::~CommanderCore(){
 
-  // write the 'current_index'-th element to the 'i'-th element
-  API_tree[index] = API_tree[current_index];
+	if( indexOwned ){
 
-  // write the buffer to the 'current_index'-th element
-  API_tree[current_index] = buffer;
+		freeIndex( &index );
 
-}
+	}
 
-void Commander::optimize_api_tree(){
+	#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
 
-	uint32_t i;
+	disableWeightedSearch();
 
-	//API_t buffer;
+	#endif
 
-	// Stores the next elements address in the tree
-	API_t *next;
+}
 
-	// Stores the previous elements address in the tree
-	API_t *prev;
+void CommanderCore::attachAliasesFunction( const commandAlias_t *aliases_p, uint32_t size ){
 
-	// It will store string comparison result
-	int32_t comp_res;
+	aliasTable = aliases_p;
+	aliasTableSize = size;
 
-	// recursive optimizer need to initialize elementCounter to 0
-	elementCounter = 0;
+}
 
-	// recursively finds the order which is optimal for a balanced tree
-	recursive_optimizer( 0, API_tree_size - 1 );
+void CommanderCore::attachIndex( const commandIndex_t *index_p ){
 
-	// The order is good, but the connection between the branches broken,
-	// because we swapped the API_tree array elements.
-	// To fix this problem we have to add elements from index 1 and
-	// place them in the binary tree.
-	for( i = 1; i < API_tree_size; i++ ){
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
 
-		prev = &API_tree[ 0 ];
+	// The own index replaces the shared one.
+	sharedIndex = NULL;
 
-		comp_res = ( this ->* commander_strcmp )( prev, &API_tree[ i ] );
+	#endif
 
-		(comp_res > 0) ? (next = (prev->left)) : ( next = (prev->right));
+	attach_index( index_p );
 
-		while( next != NULL ){
+}
 
-			prev = next;
-			comp_res = ( this ->* commander_strcmp )( prev, &API_tree[ i ] );
-			(comp_res > 0) ? (next = (prev->left)) : ( next = (prev->right));
+void CommanderCore::attach_index( const commandIndex_t *index_p ){
 
-		}
+	// Release the index that was created by this object.
+	if( indexOwned ){
 
-		( comp_res > 0 ) ? ( ( prev->left ) = &API_tree[ i ] ) : ( ( prev->right ) = &API_tree[ i ] );
+		freeIndex( &index );
+		indexOwned = false;
 
 	}
 
-}
-
-void Commander::recursive_optimizer( int32_t start_index, int32_t stop_index ){
-
-	// The middle number between start and stop index
-	// will be stored in this variable.
-	int32_t mid;
+	index = *index_p;
+	commands_changed();
 
-	// Detect the end of recursion.
-	if( start_index > stop_index ){
+	#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
 
-		return;
+	// The weights belong to the places of the previous index.
+	disableWeightedSearch();
 
-	}
+	#endif
 
-	// Find the middle of the interval
-	mid = ( start_index + stop_index ) / 2;
+	#ifdef COMMANDER_ENABLE_HASH_TABLE
 
-	// Put the right element to it's place
-	swap_api_elements( elementCounter, mid );
-	elementCounter++;
+	// The index replaces the hash table.
+	hashSeeds = NULL;
+	hashSlots = NULL;
 
-	// Do some recursion for the other intervals
-	recursive_optimizer( start_index, mid - 1 );
-	recursive_optimizer( mid + 1, stop_index );
+	#endif
 
+	memoryType = index.memoryType;
 
 }
 
-void Commander::executeCommand( char *cmd ){
+#ifdef COMMANDER_ENABLE_SHARED_INDEX
 
-	// The beginning of the argument list will be stored in this pointer
-	char *arg;
-
-	// This variable tracks the command name length
-	uint32_t cmd_name_cntr;
+void CommanderCore::attachSharedIndex( sharedIndex_t *shared ){
 
-	// If this flag is set, than the description message will be printed,
-	// and the commands function won't be called.
-	uint8_t show_description = 0;
+	// Empty index, until the first lookup attaches the published one.
+	#ifdef COMMANDER_CASE_INSENSITIVE
+	commandIndex_t emptyIndex = { NULL, NULL, NULL, NULL, NULL, NULL, 0, MEMORY_REGULAR, NULL, NULL };
+	#else
+	commandIndex_t emptyIndex = { NULL, NULL, NULL, NULL, NULL, NULL, 0, MEMORY_REGULAR, NULL };
+	#endif
 
-	// Pointer to the selected command data.
-	API_t *commandData_ptr;
+	// The own index is released.
+	attach_index( &emptyIndex );
 
-	int32_t pipePos;
+	sharedIndex = shared;
 
-	uint32_t i;
+	// No version has this number, so the next lookup attaches the current one.
+	sharedVersionSeen = 0xFFFFFFFFUL;
 
-	// Copy the command data to the internal buffer.
-	// It is necessary because we have to modify the content
-	// of it. If it is points to a const char array we will
-	// get a bus-fault error without a buffer.
-	strncpy( tempBuff, cmd, COMMANDER_MAX_COMMAND_SIZE );
+}
 
-	pipePos = hasChar( tempBuff, '|' );
+bool CommanderCore::publishIndex( sharedIndex_t *shared, const commandIndex_t *index ){
 
-	if( pipePos >= 0 ){
+	// The new and the old versions.
+	sharedVersion_t *newVersion = NULL;
+	sharedVersion_t *oldVersion;
 
-		#ifdef COMMANDER_ENABLE_PIPE_MODULE
-		// Terminate where pip is found.
-		tempBuff[ pipePos ] = '\0';
-		#else
+	std::lock_guard< std::mutex > writerLock( shared -> writer );
 
-			#ifdef __AVR__
-			response -> println( F( "Piping not available on this device!" ) );
-			#else
-			response -> println( (const char*)"Piping not available on this device!" );
-			#endif
+	if( index != NULL ){
 
-			return;
+		newVersion = (sharedVersion_t*)malloc( sizeof( sharedVersion_t ) );
 
-		#endif
+		if( newVersion == NULL ){
 
-	}
+			return false;
 
-	// tempBuff is the address of the first character of the incoming command.
-	// If we give arg variable the value stored in tempBuff means arg will point to
-	// the first character of the command as well.
-	arg = tempBuff;
+		}
 
-	// Reset the name counter before we start counting
-	cmd_name_cntr = 0;
+		newVersion -> index = *index;
 
-	// Find the first space, question mark or a string-end character.
-	// At this time count how long is the command name( in characters )
-	while( ( *arg != '\0' ) && ( *arg != ' ' ) && ( *arg != '?' ) ){
+		shared -> version++;
 
-		cmd_name_cntr++;
-		arg++;
+		// 0 is the version of the empty index.
+		if( shared -> version == 0 ){
 
-	}
+			shared -> version = 1;
 
-	// If a space character found we have to terminate the string there.
-	// It is important because strcmp function will search for string terminator
-	// character, and this way we can separate the command name from its arguments.
-	if( *arg == ' ' ){
+		}
 
-		*arg = '\0';
-		arg++;
+		newVersion -> version = shared -> version;
 
 	}
 
-	// The process is the same as above. The only difference is that this time
-	// we have to set the show_description flag.
-	else if( *arg == '?' ){
-
-		*arg = '\0';
-		arg++;
-		show_description = 1;
+	// The readers see the old or the new version, never a half-built one.
+	oldVersion = shared -> current.exchange( newVersion );
 
-	}
+	// Wait for the grace period, then nobody can use the old version.
+	shared_synchronize( shared );
 
-	// Try to find the command datata.
-	commandData_ptr = (*this)[ tempBuff ];
+	if( oldVersion != NULL ){
 
-	// If it is not a NULL pointer, that means we have a mtach.
-	if( commandData_ptr ){
+		freeIndex( &oldVersion -> index );
+		free( oldVersion );
 
-		// Because we have found the command in the API tree we have to choose
-		// between description printing and executing.
-		// If show_description flag is set, than we have to print the description.
-		if( show_description ){
+	}
 
-			if( memoryType == MEMORY_REGULAR ){
+	return true;
 
-				// Print the description text to the output channel.
-				response -> print( commandData_ptr -> name );
-				response -> print( ':' );
-				response -> print( ' ' );
-				response -> println( commandData_ptr -> desc );
+}
 
-			}
+void CommanderCore::shared_synchronize( sharedIndex_t *shared ){
 
-			#ifdef __AVR__
+	// Generic counter variable.
+	uint8_t i;
 
-			else if( memoryType == MEMORY_PROGMEM ){
+	// The epoch before the flip.
+	uint32_t epoch;
 
-				// Print the description text to the output channel.
-				response -> print( commandData_ptr -> name_P );
-				response -> print( ':' );
-				response -> print( ' ' );
-				response -> println( commandData_ptr -> desc_P );
+	// A reader can read the epoch before the flip, but count itself
+	// after it. Because of this both counters have to be drained,
+	// each of them after the epoch is flipped away from it. The new
+	// readers use the other counter, so the waiting always ends.
+	for( i = 0; i < 2; i++ ){
 
-			}
+		epoch = shared -> epoch.fetch_add( 1 );
 
-			#endif
+		while( shared -> readers[ epoch & 1 ].load() != 0 ){
 
+			std::this_thread::yield();
 
 		}
 
-		// If show_description flag is not set, than we have to execute the commands function.
-		else{
+	}
 
-			#ifdef COMMANDER_ENABLE_PIPE_MODULE
+}
 
-			if( pipeChannel.available() > 0 ){
+#endif
 
-				// pipeChannel.readBytesUntil( '\0', pipeArgBuffer, COMMANDER_MAX_COMMAND_SIZE );
+uint8_t CommanderCore::shared_lock(){
 
-				i = 0;
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
 
-				while( pipeChannel.available() ){
+	// The reader counter of the actual epoch.
+	uint8_t slot;
 
-					if( i < COMMANDER_MAX_COMMAND_SIZE ){
+	// The published version.
+	sharedVersion_t *current;
 
-						pipeArgBuffer[ i ] = pipeChannel.read();
+	// Empty index, if nothing is published.
+	#ifdef COMMANDER_CASE_INSENSITIVE
+	commandIndex_t emptyIndex = { NULL, NULL, NULL, NULL, NULL, NULL, 0, MEMORY_REGULAR, NULL, NULL };
+	#else
+	commandIndex_t emptyIndex = { NULL, NULL, NULL, NULL, NULL, NULL, 0, MEMORY_REGULAR, NULL };
+	#endif
 
-					}
+	if( sharedIndex == NULL ){
 
-					else{
+		return 0;
 
-						pipeChannel.read();
+	}
 
-					}
+	slot = sharedIndex -> epoch.load() & 1;
+	sharedIndex -> readers[ slot ].fetch_add( 1 );
 
-					i++;
+	// The version is loaded after the reader is counted,
+	// so it can not be released until the section ends.
+	current = sharedIndex -> current.load();
 
-				}
+	if( current == NULL ){
 
-				if( i < COMMANDER_MAX_COMMAND_SIZE ){
+		if( sharedVersionSeen != 0 ){
 
-					pipeArgBuffer[ i ] = '\0';
+			attach_index( &emptyIndex );
+			sharedVersionSeen = 0;
 
-				}
+		}
 
-				pipeArgBuffer[ COMMANDER_MAX_COMMAND_SIZE - 1 ] = '\0';
+	}
 
-				arg = pipeArgBuffer;
+	// The lookup cache and the help cache are dropped
+	// by attach_index, when a new version is attached.
+	else if( current -> version != sharedVersionSeen ){
 
-			}
+		attach_index( &current -> index );
+		sharedVersionSeen = current -> version;
 
-			if( pipePos > 0 ){
+	}
 
-				// Execute commands function and redirect the output to pipe.
-				(commandData_ptr -> func)( arg, &pipeChannel );
+	return slot;
 
-			}
+	#else
 
-			else{
+	return 0;
 
-				// Execute command function.
-				(commandData_ptr -> func)( arg, response );
+	#endif
 
-			}
+}
 
-			if( pipePos > 0 ){
+void CommanderCore::shared_unlock( uint8_t slot ){
 
-				// To remowe whitespace from the new command begin.
-				while( tempBuff[ pipePos + 1 ] == ' ' ){
-					pipePos++;
-				}
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
 
-				executeCommand( &tempBuff[ pipePos + 1 ] );
+	if( sharedIndex != NULL ){
 
-			}
+		sharedIndex -> readers[ slot ].fetch_sub( 1 );
 
-			#else
+	}
 
-			// Execute command function.
-			(commandData_ptr -> func)( arg, response );
+	#else
 
-			#endif
+	( void )slot;
 
-		}
+	#endif
 
-	}
+}
 
-	// If it is not an added function, we have to check for internal functions.
-	// 'help' is an internal function that prints the available commands in order.
-	else if( strcmp( tempBuff, (const char*)"help" ) == 0 ){
+#ifdef COMMANDER_ENABLE_HASH_TABLE
 
-		// We have to check for single or described help function.
-		if( strcmp( arg, (const char*)"-d" ) == 0 ){
+void CommanderCore::attachHashTableFunction( const API_t * const *elements, uint32_t size, const char * const *names, const uint8_t *lengths, const commandFunction_t *funcs, const uint16_t *seeds, uint32_t bucketCount, const uint16_t *slots ){
 
-			helpFunction( true );
+	// The hash table is used as a search index without
+	// prefix words and fingerprints.
+	#ifdef COMMANDER_CASE_INSENSITIVE
 
-		}
+	// The names of the generated table are used as the keys.
+	commandIndex_t tableIndex = { elements, names, lengths, funcs, NULL, NULL, size, MEMORY_REGULAR, NULL, names };
 
-		else{
+	#else
 
-			helpFunction();
+	commandIndex_t tableIndex = { elements, names, lengths, funcs, NULL, NULL, size, MEMORY_REGULAR, NULL };
 
-		}
+	#endif
 
-	}
+	attachIndex( &tableIndex );
 
-	else{
+	hashSeeds       = seeds;
+	hashBucketCount = bucketCount;
+	hashSlots       = slots;
 
-		// If we went through the whole tree and we did not found the command in it,
-		// we have to notice the user abut the problem. Maybe a Type-O
-		#if defined( ARDUINO ) && defined( __AVR__ )
+	#if defined( ARDUINO ) && defined( __AVR__ )
 
-		response -> print( F( "Command \'" ) );
-		response -> print( tempBuff );
-		response -> println( F( "\' not found!" ) );
+	dbgResponse -> print( F( "Hash table attached with " ) );
+	dbgResponse -> print( index.size );
+	dbgResponse -> println( F( " commands." ) );
 
-		#else
+	#else
 
-		response -> print( (const char*)"Command \'" );
-		response -> print( tempBuff );
-		response -> println( (const char*)"\' not found!" );
+	dbgResponse -> print( (const char*)"Hash table attached with "  );
+	dbgResponse -> print( index.size );
+	dbgResponse -> println( " commands." );
 
-		#endif
+	#endif
 
-		#ifdef COMMANDER_ENABLE_PIPE_MODULE
+}
 
-		// Clear the pipe at error.
-		while( pipeChannel.available() ){
+int32_t CommanderCore::hashSearch( const char *name, uint32_t length ){
 
-			pipeChannel.read();
+	uint32_t hash;
+	uint16_t place;
 
-		}
-		
-		#endif
+	hash = commanderHashString( name );
 
-	}
+	// Find the slot with the displacement value of the bucket.
+	place = hashSlots[ commanderHashMix( hash, hashSeeds[ hash % hashBucketCount ] ) % index.size ];
 
-}
+	// Every slot is used in a minimal perfect hash table, but
+	// unknown names are mapped to a slot too, so it has to be verified.
+	if( ( index.lengths[ place ] == commander_name_length( length ) ) && ( commander_name_cmp( index.names[ place ], name ) == 0 ) ){
 
-void Commander::execute( char *cmd ){
+		return place;
 
-	// Default execute handler, so the default response will be chosen.
-	response = &defaultResponse;
+	}
 
-	// Execute the command.
-	executeCommand( cmd );
+	return -1;
 
 }
 
-void Commander::execute( const char *cmd ){
+#endif
 
-	// Default execute handler, so the default response will be chosen.
-	response = &defaultResponse;
+bool CommanderCore::createIndex( commandIndex_t *index, const API_t *tree, uint32_t size, const commandAlias_t *aliases, uint32_t aliasCount ){
 
-	// Execute the command.
-	executeCommand( (char*)cmd );
+	// A single API-tree is a special case of the merged index.
+	commandTree_t singleTree = { tree, size };
+
+	return createIndex( index, &singleTree, 1, aliases, aliasCount, NULL );
 
 }
 
-void Commander::execute( char *cmd, Stream *resp ){
+bool CommanderCore::createIndex( commandIndex_t *index, const commandTree_t *trees, uint32_t treeCount, const commandAlias_t *aliases, uint32_t aliasCount, Print *report ){
 
-	response = resp;
+	// Generic counter variables.
+	uint32_t i;
+	uint32_t j;
 
-	// Execute the command.
-	executeCommand( cmd );
+	// Number of commands in all of the API-trees.
+	uint32_t size;
 
-}
+	// Number of entries, the commands and the valid aliases.
+	uint32_t entries;
 
-void Commander::execute( const char *cmd, Stream *resp ){
+	// Place of the command of an alias.
+	uint32_t place;
 
-	response = resp;
+	// Number of segments that are not empty.
+	uint32_t usedSegments;
 
-	// Execute the command.
-	executeCommand( (char*)cmd );
+	// Every API-tree is a segment and the aliases are the last one.
+	// The i-th segment starts at bounds[ i ] and ends before bounds[ i + 1 ].
+	uint32_t bounds[ COMMANDER_MAX_TREE_COUNT + 2 ];
 
-}
+	// The segments are sorted here before the merge. If there is
+	// only one segment, it is sorted in the index itself.
+	const char **sourceNames;
+	const API_t **sourceElements;
+	void *mergeMemory = NULL;
 
-void Commander::attachDebugChannel( Stream *resp ){
+	// Pointers to the arrays in the allocated memory area.
+	commanderWord_t *prefixes;
+	const API_t **elements;
+	const char **names;
+	commandFunction_t *funcs;
+	uint8_t *lengths;
+	uint8_t *fingerprints;
 
-	dbgResponse = resp;
+	// Size of the memory area.
+	uint32_t memorySize;
 
-	// Enable debug messages.
-	debugEnabled = true;
+	#ifdef COMMANDER_CASE_INSENSITIVE
 
-}
+	// Lower case names.
+	const char **keys = NULL;
 
-void Commander::enableDebug(){
+	// The characters of the lower case copies.
+	char *keyChars = NULL;
 
-	debugEnabled = true;
+	// Number of characters in the lower case copies.
+	uint32_t keySize = 0;
 
-}
+	#endif
 
-void Commander::disableDebug(){
+	#ifdef __AVR__
 
-	debugEnabled = false;
+	// With the PROGMEM implementation the names have to be
+	// copied to RAM for the key calculation.
+	char progmemBuffer[ COMMANDER_MAX_COMMAND_SIZE ];
 
-}
+	#endif
 
-Commander::API_t* Commander::operator [] ( int i ){
+	index -> elements     = NULL;
+	index -> names        = NULL;
+	index -> lengths      = NULL;
+	index -> funcs        = NULL;
+	index -> prefixes     = NULL;
+	index -> fingerprints = NULL;
+	index -> size         = 0;
+	index -> memoryType   = MEMORY_REGULAR;
+	index -> memory       = NULL;
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+	index -> keys         = NULL;
+	#endif
 
-	// Detect wrong addressing.
-	if( ( i < 0 ) || ( i >= (int)API_tree_size ) ){
+	if( treeCount > COMMANDER_MAX_TREE_COUNT ){
 
-		return NULL;
+		return false;
 
 	}
 
-	return &API_tree[ i ];
+	size = 0;
+	usedSegments = 0;
 
-}
+	for( i = 0; i < treeCount; i++ ){
 
-Commander::API_t* Commander::operator [] ( char* name ){
+		if( trees[ i ].size == 0 ){
 
-	// Stores the next elements address in the tree
-	API_t *next;
+			continue;
 
-	// Stores the previous elements address in the tree
-	API_t *prev;
+		}
 
-	// It will store string compersation result
-	int8_t comp_res;
+		#ifdef __AVR__
 
-	prev = &API_tree[ 0 ];
+		// The PROGMEM elements are created with the apiElement_P
+		// macro, it leaves the regular name empty.
+		if( ( size == 0 ) && ( trees[ i ].tree[ 0 ].name == NULL ) ){
 
-	comp_res = ( this ->* commander_strcmp_tree_ram )( prev, name );
+			index -> memoryType = MEMORY_PROGMEM;
 
-	(comp_res > 0) ? (next = (prev->left)) : ( next = (prev->right));
+		}
 
-	// Go through the binary tree until you find a match, or until you find the
-	// end of the tree.
-	while( ( comp_res !=0 ) && ( next != NULL ) ){
+		#endif
 
-		prev = next;
-		comp_res = ( this ->* commander_strcmp_tree_ram )( prev, name );
-		(comp_res > 0) ? (next = (prev->left)) : ( next = (prev->right));
+		size += trees[ i ].size;
+		usedSegments++;
 
 	}
 
-	// If comp_res variable has a zero in it, that means in the last iteration
-	// we had a match.
-	if( comp_res == 0 ){
+	if( size == 0 ){
 
-		return prev;
+		return true;
 
 	}
 
-	// If we did not found the command we return NULL.
-	return NULL;
+	if( aliases == NULL ){
 
-}
+		aliasCount = 0;
 
-Commander::API_t* Commander::operator [] ( const char* name ){
+	}
 
-	return (*this)[ (char*)name ];
+	if( aliasCount > 0 ){
 
-}
+		usedSegments++;
 
-void Commander::helpFunction( bool description ){
+	}
 
-	helpFunction( description, response );
+	// One memory area is allocated for the whole index.
+	// The arrays with bigger elements are placed first
+	// to keep the alignment right.
+	memorySize = ( size + aliasCount ) * ( sizeof( commanderWord_t ) + sizeof( const API_t* ) + sizeof( const char* ) + sizeof( commandFunction_t ) + sizeof( uint8_t ) + sizeof( uint8_t ) );
 
-}
+	#ifdef COMMANDER_CASE_INSENSITIVE
 
-void Commander::helpFunction( bool description, Stream* out, bool style ){
+	// The lower case copies are stored in the same memory area.
+	// The names without upper case characters are not copied.
+	// The PROGMEM names are compared with strcasecmp_P instead.
+	if( index -> memoryType == MEMORY_REGULAR ){
 
-	uint32_t i;
-	uint32_t j;
+		for( i = 0; i < treeCount; i++ ){
 
-	if( style ){
+			for( j = 0; j < trees[ i ].size; j++ ){
 
-		#if defined( ARDUINO ) && defined( __AVR__ )
+				keySize += key_size( trees[ i ].tree[ j ].name );
 
-		out -> println( F( "\033[1;31m----\033[1;32m Available commands \033[1;31m----\033[0;37m\r\n" ) );
+			}
 
-		#else
+		}
+
+		for( i = 0; i < aliasCount; i++ ){
+
+			if( aliases[ i ].name != NULL ){
+
+				keySize += key_size( aliases[ i ].name );
+
+			}
+
+		}
+
+		memorySize += ( size + aliasCount ) * sizeof( const char* ) + keySize;
+
+	}
+
+	#endif
+
+	index -> memory = malloc( memorySize );
+
+	if( index -> memory == NULL ){
+
+		return false;
+
+	}
+
+	prefixes     = (commanderWord_t*)index -> memory;
+	elements     = (const API_t**)&prefixes[ size + aliasCount ];
+	names        = (const char**)&elements[ size + aliasCount ];
+	funcs        = (commandFunction_t*)&names[ size + aliasCount ];
+	lengths      = (uint8_t*)&funcs[ size + aliasCount ];
+	fingerprints = &lengths[ size + aliasCount ];
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+
+	if( index -> memoryType == MEMORY_REGULAR ){
+
+		keys     = (const char**)&funcs[ size + aliasCount ];
+		lengths  = (uint8_t*)&keys[ size + aliasCount ];
+		fingerprints = &lengths[ size + aliasCount ];
+		keyChars = (char*)&fingerprints[ size + aliasCount ];
+
+	}
+
+	#endif
+
+	sourceNames = names;
+	sourceElements = elements;
+
+	// More segments can not be merged in place.
+	if( usedSegments > 1 ){
+
+		mergeMemory = malloc( ( size + aliasCount ) * ( sizeof( const API_t* ) + sizeof( const char* ) ) );
+
+		if( mergeMemory == NULL ){
+
+			freeIndex( index );
+			return false;
+
+		}
+
+		sourceElements = (const API_t**)mergeMemory;
+		sourceNames = (const char**)&sourceElements[ size + aliasCount ];
+
+	}
+
+	// Only the pointers are sorted, the API-trees are not modified.
+	entries = 0;
+
+	for( i = 0; i < treeCount; i++ ){
+
+		bounds[ i ] = entries;
+
+		for( j = 0; j < trees[ i ].size; j++ ){
+
+			sourceElements[ entries ] = &trees[ i ].tree[ j ];
+			sourceNames[ entries ] = trees[ i ].tree[ j ].name;
+
+			#ifdef __AVR__
+
+			if( index -> memoryType == MEMORY_PROGMEM ){
+
+				sourceNames[ entries ] = (const char*)trees[ i ].tree[ j ].name_P;
+
+			}
+
+			#endif
+
+			entries++;
+
+		}
+
+	}
+
+	bounds[ treeCount ] = entries;
+
+	// The aliases are entries with their own name,
+	// but they point to the element of the command.
+	for( i = 0; i < aliasCount; i++ ){
+
+		if( ( aliases[ i ].name == NULL ) || ( aliases[ i ].command >= size ) ){
+
+			continue;
+
+		}
+
+		// The place is counted through the trees in attach order.
+		place = aliases[ i ].command;
+		j = 0;
+
+		while( place >= trees[ j ].size ){
+
+			place -= trees[ j ].size;
+			j++;
+
+		}
+
+		sourceElements[ entries ] = &trees[ j ].tree[ place ];
+		sourceNames[ entries ] = aliases[ i ].name;
+		entries++;
+
+	}
+
+	bounds[ treeCount + 1 ] = entries;
+
+	for( i = 0; i < treeCount + 1; i++ ){
+
+		sort_index( &sourceNames[ bounds[ i ] ], &sourceElements[ bounds[ i ] ], bounds[ i + 1 ] - bounds[ i ], index -> memoryType );
+
+	}
+
+	entries = merge_index( sourceNames, sourceElements, bounds, treeCount + 1, names, elements, index -> memoryType, report );
+
+	free( mergeMemory );
+
+	for( i = 0; i < entries; i++ ){
+
+		if( index -> memoryType == MEMORY_REGULAR ){
+
+			lengths[ i ] = commander_name_length( strlen( names[ i ] ) );
+			name_key( names[ i ], strlen( names[ i ] ), &prefixes[ i ], &fingerprints[ i ] );
+
+			#ifdef COMMANDER_CASE_INSENSITIVE
+
+			keys[ i ] = names[ i ];
+
+			if( key_size( names[ i ] ) > 0 ){
+
+				for( j = 0; names[ i ][ j ] != '\0'; j++ ){
+
+					keyChars[ j ] = commander_fold( names[ i ][ j ] );
+
+				}
+
+				keyChars[ j ] = '\0';
+				keys[ i ] = keyChars;
+				keyChars += j + 1;
+
+			}
+
+			#endif
+
+		}
+
+		#ifdef __AVR__
+
+		else if( index -> memoryType == MEMORY_PROGMEM ){
+
+			lengths[ i ] = commander_name_length( strlen_P( (PGM_P)names[ i ] ) );
+
+			strncpy_P( progmemBuffer, (PGM_P)names[ i ], COMMANDER_MAX_COMMAND_SIZE );
+			progmemBuffer[ COMMANDER_MAX_COMMAND_SIZE - 1 ] = '\0';
+			name_key( progmemBuffer, strlen( progmemBuffer ), &prefixes[ i ], &fingerprints[ i ] );
+
+		}
+
+		#endif
+
+		funcs[ i ] = elements[ i ] -> func;
+
+	}
+
+	index -> elements     = elements;
+	index -> names        = names;
+	index -> lengths      = lengths;
+	index -> funcs        = funcs;
+	index -> prefixes     = prefixes;
+	index -> fingerprints = fingerprints;
+	index -> size         = entries;
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+	index -> keys         = keys;
+	#endif
+
+	return true;
+
+}
+
+uint32_t CommanderCore::merge_index( const char **names, const API_t **elements, const uint32_t *bounds, uint32_t segments, const char **outNames, const API_t **outElements, memoryType_t type, Print *report ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// The segment with the smallest head.
+	uint32_t selected;
+
+	// Number of merged entries.
+	uint32_t entries = 0;
+
+	// The next entry of every segment.
+	uint32_t heads[ COMMANDER_MAX_TREE_COUNT + 1 ];
+
+	for( i = 0; i < segments; i++ ){
+
+		heads[ i ] = bounds[ i ];
+
+	}
+
+	while( true ){
+
+		selected = segments;
+
+		// On equal names the earlier segment is selected,
+		// so the first attached tree wins.
+		for( i = 0; i < segments; i++ ){
+
+			if( heads[ i ] >= bounds[ i + 1 ] ){
+
+				continue;
+
+			}
+
+			if( ( selected == segments ) || ( compare_names( names[ heads[ i ] ], names[ heads[ selected ] ], type ) < 0 ) ){
+
+				selected = i;
+
+			}
+
+		}
+
+		// Every segment is empty.
+		if( selected == segments ){
+
+			break;
+
+		}
+
+		// The merged names are sorted, so a duplicate
+		// can only match the last merged name.
+		if( ( entries > 0 ) && ( compare_names( outNames[ entries - 1 ], names[ heads[ selected ] ], type ) == 0 ) ){
+
+			if( report != NULL ){
+
+				#if defined( ARDUINO ) && defined( __AVR__ )
+
+				report -> print( F( "\tDuplicate command: " ) );
+
+				if( type == MEMORY_PROGMEM ){
+
+					report -> println( (const __FlashStringHelper*)names[ heads[ selected ] ] );
+
+				}
+
+				else{
+
+					report -> println( names[ heads[ selected ] ] );
+
+				}
+
+				#else
+
+				report -> print( (const char*)"\tDuplicate command: " );
+				report -> println( names[ heads[ selected ] ] );
+
+				#endif
+
+			}
+
+		}
+
+		else{
+
+			outNames[ entries ] = names[ heads[ selected ] ];
+			outElements[ entries ] = elements[ heads[ selected ] ];
+			entries++;
+
+		}
+
+		heads[ selected ]++;
+
+	}
+
+	return entries;
+
+}
+
+void CommanderCore::freeIndex( commandIndex_t *index ){
+
+	free( index -> memory );
+
+	index -> elements     = NULL;
+	index -> names        = NULL;
+	index -> lengths      = NULL;
+	index -> funcs        = NULL;
+	index -> prefixes     = NULL;
+	index -> fingerprints = NULL;
+	index -> size         = 0;
+	index -> memory       = NULL;
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+	index -> keys         = NULL;
+	#endif
+
+}
+
+void CommanderCore::sort_index( const char **names, const API_t **elements, uint32_t size, memoryType_t type ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// Heap sort is used because it runs in O( n log n ) time
+	// in every case and it does not need any extra memory.
+	// Firstly build a max-heap from the array.
+	for( i = size / 2; i > 0; i-- ){
+
+		sift_down_index( names, elements, i - 1, size, type );
+
+	}
+
+	// Then move the largest element to the end of the
+	// array one by one, and restore the heap for the rest.
+	for( i = size; i > 1; i-- ){
+
+		swap_index( names, elements, 0, i - 1 );
+		sift_down_index( names, elements, 0, i - 1, type );
+
+	}
+
+}
+
+void CommanderCore::sift_down_index( const char **names, const API_t **elements, uint32_t root, uint32_t size, memoryType_t type ){
+
+	// Index of the larger child.
+	uint32_t child;
+
+	// Go down until the root has at least one child.
+	while( ( 2 * root + 1 ) < size ){
+
+		child = 2 * root + 1;
+
+		// Select the larger child.
+		if( ( ( child + 1 ) < size ) && ( compare_names( names[ child ], names[ child + 1 ], type ) < 0 ) ){
+
+			child++;
+
+		}
+
+		// If the root is not smaller than the larger child,
+		// the heap property is restored.
+		if( compare_names( names[ root ], names[ child ], type ) >= 0 ){
+
+			return;
+
+		}
+
+		swap_index( names, elements, root, child );
+
+		root = child;
+
+	}
+
+}
+
+void CommanderCore::swap_index( const char **names, const API_t **elements, uint32_t a, uint32_t b ){
+
+	// Temporary variables, used to flip entries.
+	const char *tempName;
+	const API_t *tempElement;
+
+	tempName = names[ a ];
+	names[ a ] = names[ b ];
+	names[ b ] = tempName;
+
+	tempElement = elements[ a ];
+	elements[ a ] = elements[ b ];
+	elements[ b ] = tempElement;
+
+}
+
+int CommanderCore::compare_names( const char *name1, const char *name2, memoryType_t type ){
+
+	#ifdef __AVR__
+
+	// Characters of the names.
+	uint8_t c1;
+	uint8_t c2;
+
+	if( type == MEMORY_PROGMEM ){
+
+		// Both names are in PROGMEM, so they are compared
+		// character by character without a buffer.
+		do{
+
+			c1 = commander_fold( pgm_read_byte( name1++ ) );
+			c2 = commander_fold( pgm_read_byte( name2++ ) );
+
+		}while( ( c1 != '\0' ) && ( c1 == c2 ) );
+
+		return (int)c1 - (int)c2;
+
+	}
+
+	#else
+
+	// The names are always in RAM.
+	( void )type;
+
+	#endif
+
+	return commander_name_cmp( name1, name2 );
+
+}
+
+#ifdef COMMANDER_CASE_INSENSITIVE
+
+uint32_t CommanderCore::key_size( const char *name ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// Flag for the upper case characters.
+	bool upper = false;
+
+	for( i = 0; name[ i ] != '\0'; i++ ){
+
+		if( commander_fold( name[ i ] ) != name[ i ] ){
+
+			upper = true;
+
+		}
+
+	}
+
+	return upper ? ( i + 1 ) : 0;
+
+}
+
+#endif
+
+bool CommanderCore::is_alias( uint32_t place ){
+
+	#ifdef __AVR__
+
+	if( memoryType == MEMORY_PROGMEM ){
+
+		return index.names[ place ] != (const char*)index.elements[ place ] -> name_P;
+
+	}
+
+	#endif
+
+	return index.names[ place ] != index.elements[ place ] -> name;
+
+}
+
+int32_t CommanderCore::search_index( const char *name, uint32_t length ){
+
+	// The first element of the interval, where the command can be.
+	uint32_t base;
+
+	// The size of the interval.
+	uint32_t size;
+
+	// Half of the interval.
+	uint32_t half;
+
+	// Prefix word and fingerprint of the searched name.
+	commanderWord_t prefix;
+	uint8_t fingerprint;
+
+	#ifdef COMMANDER_ENABLE_STATISTICS
+	lookupCounter++;
+	#endif
+
+	#ifdef COMMANDER_ENABLE_HASH_TABLE
+
+	if( hashSlots != NULL ){
+
+		return hashSearch( name, length );
+
+	}
+
+	#endif
+
+	if( index.size == 0 ){
+
+		return -1;
+
+	}
+
+	name_key( name, length, &prefix, &fingerprint );
+
+	#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+	if( weightRoot != COMMANDER_WEIGHT_NONE ){
+
+		return weighted_search( name, length, prefix, fingerprint );
+
+	}
+
+	#endif
+
+	base = 0;
+	size = index.size;
+
+	// Branchless binary search. The interval is halved in every
+	// iteration and the result of the comparison only selects the
+	// new base with a conditional move instead of a jump.
+	while( size > 1 ){
+
+		half = size / 2;
+		base = ( compare_index( base + half, name, length, prefix ) <= 0 ) ? ( base + half ) : base;
+		size -= half;
+
+	}
+
+	// The lengths and the fingerprints are compared first, because
+	// they can prove a mismatch without reading the name.
+	if( ( index.lengths[ base ] == commander_name_length( length ) ) && ( index.fingerprints[ base ] == fingerprint ) && ( compare_index( base, name, length, prefix ) == 0 ) ){
+
+		return base;
+
+	}
+
+	return -1;
+
+}
+
+void CommanderCore::name_key( const char *name, uint32_t length, commanderWord_t *prefix, uint8_t *fingerprint ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// Hash of the name.
+	uint32_t hash;
+
+	*prefix = 0;
+
+	// The first characters are packed in big-endian order.
+	// Shorter names are padded with zeros, like the string
+	// terminator character, so the order is not changed.
+	for( i = 0; i < sizeof( commanderWord_t ); i++ ){
+
+		*prefix <<= 8;
+
+		if( i < length ){
+
+			*prefix |= (uint8_t)commander_fold( name[ i ] );
+
+		}
+
+	}
+
+	hash = name_hash( name, length );
+
+	// Fold the hash to 8 bits.
+	hash ^= hash >> 16;
+	hash ^= hash >> 8;
+	*fingerprint = (uint8_t)hash;
+
+}
+
+uint32_t CommanderCore::name_hash( const char *name, uint32_t length ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// FNV-1a hash of the name.
+	uint32_t hash = 2166136261UL;
+
+	for( i = 0; i < length; i++ ){
+
+		hash ^= (uint8_t)commander_fold( name[ i ] );
+		hash *= 16777619UL;
+
+	}
+
+	return hash;
+
+}
+
+CommanderCore::API_t* CommanderCore::find_command( const char *name, uint32_t length, commandFunction_t *func, memoryType_t *elementMemory ){
+
+	// Alphabetical place of the command.
+	int32_t place;
+
+	// Node of the command in the dynamic command tree.
+	commandNode_t *node;
+
+	// The command that has been found.
+	API_t *element;
+
+	// Name of the command in the search structure.
+	const char *elementName;
+
+	#if ( COMMANDER_LOOKUP_CACHE_SIZE > 0 )
+
+	// Hash of the name.
+	uint32_t hash;
+
+	// The cache entry that belongs to the hash.
+	lookupCacheEntry_t *entry;
+
+	// Result of the name comparison.
+	int result = 1;
+
+	hash = name_hash( name, length );
+	entry = &lookupCache[ hash % COMMANDER_LOOKUP_CACHE_SIZE ];
+
+	// The hash and the length can be the same for different
+	// names, so one string comparison is still necessary.
+	if( ( entry -> name != NULL ) && ( entry -> hash == hash ) && ( entry -> length == commander_name_length( length ) ) ){
+
+		if( entry -> memory == MEMORY_REGULAR ){
+
+			result = commander_name_cmp( entry -> name, name );
+
+		}
+
+		else{
+
+			result = commander_strcmp_tree_ram( entry -> name, name );
+
+		}
+
+	}
+
+	if( result == 0 ){
+
+		cacheHitCounter++;
+
+		#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+		if( entry -> place >= 0 ){
+
+			weighted_count( entry -> place );
+
+		}
+
+		#endif
+
+		*func = entry -> func;
+		*elementMemory = entry -> memory;
+		return entry -> element;
+
+	}
+
+	cacheMissCounter++;
+
+	#endif
+
+	place = search_index( name, length );
+
+	if( place >= 0 ){
+
+		element = (API_t*)index.elements[ place ];
+		elementName = index.names[ place ];
+		*func = index.funcs[ place ];
+		*elementMemory = memoryType;
+
+		#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+		weighted_count( place );
+
+		#endif
+
+	}
+
+	// If we did not found the command in the API-tree,
+	// it can be in the dynamic command tree.
+	else{
+
+		node = dynamic_search( name );
+
+		if( node == NULL ){
+
+			return NULL;
+
+		}
+
+		element = node -> element;
+		elementName = element -> name;
+		*func = element -> func;
+		*elementMemory = MEMORY_REGULAR;
+
+	}
+
+	#if ( COMMANDER_LOOKUP_CACHE_SIZE > 0 )
+
+	// The last found command replaces the previous one in the entry.
+	entry -> hash = hash;
+	entry -> length = commander_name_length( length );
+	entry -> name = elementName;
+	entry -> element = element;
+	entry -> func = *func;
+	entry -> memory = *elementMemory;
+	entry -> place = place;
+
+	#else
+
+	( void )elementName;
+
+	#endif
+
+	return element;
+
+}
+
+#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+bool CommanderCore::enableWeightedSearch(){
+
+	disableWeightedSearch();
+
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
+
+	// The tree is rebuilt in place, so the readers could see a
+	// half-built tree. It is not available with a shared index.
+	if( sharedIndex != NULL ){
+
+		return false;
+
+	}
+
+	#endif
+
+	// The children are stored on 16 bits.
+	if( ( index.size == 0 ) || ( index.size >= COMMANDER_WEIGHT_NONE ) ){
+
+		return false;
+
+	}
+
+	// One memory area for the counters, the prefix sums of the rebuild
+	// and the children, so the automatic rebuild does not allocate.
+	weightMemory = malloc( index.size * ( sizeof( uint32_t ) + sizeof( uint16_t ) + sizeof( uint16_t ) ) + ( index.size + 1 ) * sizeof( uint32_t ) );
+
+	if( weightMemory == NULL ){
+
+		return false;
+
+	}
+
+	weightCounts = (uint32_t*)weightMemory;
+	weightSums   = &weightCounts[ index.size ];
+	weightLeft   = (uint16_t*)&weightSums[ index.size + 1 ];
+	weightRight  = &weightLeft[ index.size ];
+
+	memset( weightCounts, 0, index.size * sizeof( uint32_t ) );
+	weightLookups = 0;
+
+	return true;
+
+}
+
+void CommanderCore::disableWeightedSearch(){
+
+	free( weightMemory );
+
+	weightMemory  = NULL;
+	weightCounts  = NULL;
+	weightSums    = NULL;
+	weightLeft    = NULL;
+	weightRight   = NULL;
+	weightRoot    = COMMANDER_WEIGHT_NONE;
+	weightLookups = 0;
+
+}
+
+bool CommanderCore::rebuildWeightedSearch(){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// Total weight of the commands.
+	uint64_t total = 0;
+
+	// The counters are shifted right by this many bits.
+	uint8_t shift = 0;
+
+	if( weightCounts == NULL ){
+
+		return false;
+
+	}
+
+	for( i = 0; i < index.size; i++ ){
+
+		total += weightCounts[ i ];
+
+	}
+
+	// Two sums are added in weighted_build, so the total has to fit
+	// in 31 bits. The counters are scaled down instead of saturating
+	// the sums, so the proportions of the weights are kept.
+	while( ( ( total >> shift ) + index.size ) > 0x7FFFFFFFUL ){
+
+		shift++;
+
+	}
+
+	// weightSums[ i ] is the total weight of the commands before the
+	// i-th place. Every command gets one extra weight, so the commands
+	// that were never used are still balanced among themselves.
+	weightSums[ 0 ] = 0;
+
+	for( i = 0; i < index.size; i++ ){
+
+		weightSums[ i + 1 ] = weightSums[ i ] + ( weightCounts[ i ] >> shift ) + 1;
+
+	}
+
+	weightRoot = weighted_build( 0, index.size, weightSums );
+	weightLookups = 0;
+
+	return true;
+
+}
+
+bool CommanderCore::importWeights( const commandWeight_t *weights, uint32_t size ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// Alphabetical place of the command.
+	int32_t place;
+
+	// The result of the rebuild.
+	bool result;
+
+	// A new shared index version disables the weights,
+	// so they are used only in the read section.
+	uint8_t slot = shared_lock();
+
+	if( weightCounts == NULL ){
+
+		shared_unlock( slot );
+		return false;
+
+	}
+
+	for( i = 0; i < size; i++ ){
+
+		place = search_index( weights[ i ].name, strlen( weights[ i ].name ) );
+
+		// The profile can be older than the firmware, the
+		// commands that are not found are skipped.
+		if( place >= 0 ){
+
+			weightCounts[ place ] = weights[ i ].weight;
+
+		}
+
+	}
+
+	result = rebuildWeightedSearch();
+
+	shared_unlock( slot );
+
+	return result;
+
+}
+
+void CommanderCore::exportWeights( Stream *out ){
+
+	// Generic counter variable.
+	uint32_t i;
+
+	uint8_t slot = shared_lock();
+
+	if( weightCounts == NULL ){
+
+		shared_unlock( slot );
+		return;
+
+	}
+
+	// The output can be pasted to the source code
+	// as the elements of a commandWeight_t array.
+	for( i = 0; i < index.size; i++ ){
+
+		if( weightCounts[ i ] == 0 ){
+
+			continue;
+
+		}
+
+		out -> print( (const char*)"apiWeight( \"" );
+
+		if( memoryType == MEMORY_REGULAR ){
+
+			out -> print( index.names[ i ] );
+
+		}
+
+		#ifdef __AVR__
+
+		else if( memoryType == MEMORY_PROGMEM ){
+
+			out -> print( (const __FlashStringHelper*)index.names[ i ] );
+
+		}
+
+		#endif
+
+		out -> print( (const char*)"\", " );
+		out -> print( weightCounts[ i ] );
+		out -> println( (const char*)" )," );
+
+	}
+
+	shared_unlock( slot );
+
+}
+
+uint16_t CommanderCore::weighted_build( uint32_t low, uint32_t high, const uint32_t *sums ){
+
+	// The first place of the interval, where the root can be.
+	uint32_t first;
+
+	// The size of the interval.
+	uint32_t count;
+
+	// Half of the interval.
+	uint32_t step;
+
+	// The selected root.
+	uint32_t root;
+
+	// Two times the weight of the half of the interval.
+	uint32_t target;
+
+	if( low >= high ){
+
+		return COMMANDER_WEIGHT_NONE;
+
+	}
+
+	// Mehlhorn's rule: the root splits the weight of the interval
+	// into two halves as equal as possible. For the root r the left
+	// side is not lighter than the right side, if
+	// sums[ r ] + sums[ r + 1 ] >= sums[ low ] + sums[ high ].
+	// It is increasing with r, so the first such place is searched.
+	target = sums[ low ] + sums[ high ];
+	first = low;
+	count = high - low;
+
+	while( count > 0 ){
+
+		step = count / 2;
+
+		if( ( sums[ first + step ] + sums[ first + step + 1 ] ) < target ){
+
+			first += step + 1;
+			count -= step + 1;
+
+		}
+
+		else{
+
+			count = step;
+
+		}
+
+	}
+
+	root = first;
+
+	// If the left side is lighter at every place, the last one is the best.
+	if( root == high ){
+
+		root = high - 1;
+
+	}
+
+	// The previous place can be closer to the half.
+	else if( ( root > low ) && ( ( target - ( sums[ root - 1 ] + sums[ root ] ) ) < ( ( sums[ root ] + sums[ root + 1 ] ) - target ) ) ){
+
+		root--;
+
+	}
+
+	weightLeft[ root ] = weighted_build( low, root, sums );
+	weightRight[ root ] = weighted_build( root + 1, high, sums );
+
+	return root;
+
+}
+
+int32_t CommanderCore::weighted_search( const char *name, uint32_t length, commanderWord_t prefix, uint8_t fingerprint ){
+
+	// The actual node of the tree.
+	uint16_t node = weightRoot;
+
+	// Result of the comparison.
+	int result;
+
+	while( node != COMMANDER_WEIGHT_NONE ){
+
+		result = compare_index( node, name, length, prefix );
+
+		if( result == 0 ){
+
+			// Like the binary search, the length and the fingerprint
+			// have to match too, otherwise the name is not found.
+			if( ( index.lengths[ node ] == commander_name_length( length ) ) && ( index.fingerprints[ node ] == fingerprint ) ){
+
+				return node;
+
+			}
+
+			return -1;
+
+		}
+
+		node = ( result > 0 ) ? weightLeft[ node ] : weightRight[ node ];
+
+	}
+
+	return -1;
+
+}
+
+void CommanderCore::weighted_count( uint32_t place ){
+
+	if( weightCounts == NULL ){
+
+		return;
+
+	}
+
+	if( weightCounts[ place ] < 0xFFFFFFFFUL ){
+
+		weightCounts[ place ]++;
+
+	}
+
+	#if ( COMMANDER_WEIGHTED_REBUILD_PERIOD > 0 )
+
+	weightLookups++;
+
+	if( weightLookups >= COMMANDER_WEIGHTED_REBUILD_PERIOD ){
+
+		rebuildWeightedSearch();
+
+	}
+
+	#endif
+
+}
+
+#endif
+
+void CommanderCore::commands_changed(){
+
+	#if ( COMMANDER_LOOKUP_CACHE_SIZE > 0 )
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// The cached elements can be removed or shadowed by the new commands.
+	for( i = 0; i < COMMANDER_LOOKUP_CACHE_SIZE; i++ ){
+
+		lookupCache[ i ].name = NULL;
+
+	}
+
+	#endif
+
+	#ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+	helpCacheValid = false;
+
+	#endif
+
+	commandsVersion++;
+
+}
+
+int CommanderCore::compare_index( uint32_t place, const char *name, uint32_t length, commanderWord_t prefix ){
+
+	// Length of the command name from the index.
+	uint32_t placeLength;
+
+	// The command name from the index.
+	const char *placeName;
+
+	#ifdef COMMANDER_ENABLE_STATISTICS
+	compareCounter++;
+	#endif
+
+	// Most of the time the first characters decide the order.
+	if( index.prefixes[ place ] != prefix ){
+
+		return ( index.prefixes[ place ] < prefix ) ? -1 : 1;
+
+	}
+
+	placeLength = index.lengths[ place ];
+
+	// If one of the names is not longer than a word, the prefix words
+	// hold all of its characters. The names are equal only if they have
+	// the same length, otherwise the shorter one is before the other,
+	// like the terminator character in strcmp.
+	if( ( placeLength <= sizeof( commanderWord_t ) ) || ( length <= sizeof( commanderWord_t ) ) ){
+
+		if( placeLength == length ){
+
+			return 0;
+
+		}
+
+		return ( placeLength < length ) ? -1 : 1;
+
+	}
+
+	// The length of very long names is not stored, the
+	// regular comparison is used for them.
+	if( ( placeLength == 255 ) || ( length >= 255 ) || ( memoryType != MEMORY_REGULAR ) ){
+
+		return commander_strcmp_tree_ram( index.names[ place ], name );
+
+	}
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+
+	// The lower case copy of the name is compared.
+	placeName = index.keys[ place ];
+
+	#else
+
+	placeName = index.names[ place ];
+
+	#endif
+
+	// Compare the rest of the shorter name with its terminator
+	// character word by word, like strcmp does.
+	if( placeLength < length ){
+
+		return commander_memcmp_words( placeName + sizeof( commanderWord_t ), name + sizeof( commanderWord_t ), placeLength - sizeof( commanderWord_t ) + 1 );
+
+	}
+
+	return commander_memcmp_words( placeName + sizeof( commanderWord_t ), name + sizeof( commanderWord_t ), length - sizeof( commanderWord_t ) + 1 );
+
+}
+
+int CommanderCore::commander_memcmp_words( const char *str1, const char *str2, uint32_t size ){
+
+	// Words loaded from the memory areas.
+	commanderWord_t word1;
+	commanderWord_t word2;
+
+	while( size >= sizeof( commanderWord_t ) ){
+
+		#ifdef COMMANDER_ENABLE_STATISTICS
+		compareCounter++;
+		#endif
+
+		memcpy( &word1, str1, sizeof( commanderWord_t ) );
+		memcpy( &word2, str2, sizeof( commanderWord_t ) );
+
+		// If the words are different, the characters of
+		// this word decide the result.
+		if( word1 != word2 ){
+
+			break;
+
+		}
+
+		str1 += sizeof( commanderWord_t );
+		str2 += sizeof( commanderWord_t );
+		size -= sizeof( commanderWord_t );
+
+	}
+
+	while( size > 0 ){
+
+		#ifdef COMMANDER_ENABLE_STATISTICS
+		compareCounter++;
+		#endif
+
+		// The incoming name is folded by the execute function,
+		// but the other callers can pass upper case characters.
+		if( commander_fold( *str1 ) != commander_fold( *str2 ) ){
+
+			return (uint8_t)commander_fold( *str1 ) - (uint8_t)commander_fold( *str2 );
+
+		}
+
+		str1++;
+		str2++;
+		size--;
+
+	}
+
+	return 0;
+
+}
+
+CommanderCore::commandStatus_t CommanderCore::executeCommand( const char *cmd, uint32_t length ){
+
+	// The beginning of the argument list will be stored in this pointer
+	char *arg;
+
+	// This variable tracks the command name length
+	uint32_t cmd_name_cntr;
+
+	// The first character and the length of the arguments in the command.
+	uint32_t argStart;
+	uint32_t argLength;
+
+	// If this flag is set, than the description message will be printed,
+	// and the commands function won't be called.
+	uint8_t show_description = 0;
+
+	// The selected command. It can be in the API-tree or in the dynamic command tree.
+	API_t *commandElement = NULL;
+
+	// Function of the selected command.
+	commandFunction_t commandFunc = NULL;
+
+	// Memory type of the selected command. The dynamic commands are always in RAM.
+	memoryType_t commandMemory = memoryType;
+
+	// Place of the pipe character in the command. It is
+	// -1, if there is no pipe character in the command.
+	int32_t pipePos = -1;
+
+	uint32_t i;
+
+	// Reset the name counter before we start counting
+	cmd_name_cntr = 0;
+
+	// Find the first space, question mark, pipe or a string-end character.
+	// At this time count how long is the command name( in characters )
+	// In the lean profile there is no description, so the question
+	// mark is not a separator.
+	#ifdef COMMANDER_LEAN
+	while( ( cmd_name_cntr < length ) && ( cmd[ cmd_name_cntr ] != '\0' ) && ( cmd[ cmd_name_cntr ] != ' ' ) && ( cmd[ cmd_name_cntr ] != '|' ) ){
+	#else
+	while( ( cmd_name_cntr < length ) && ( cmd[ cmd_name_cntr ] != '\0' ) && ( cmd[ cmd_name_cntr ] != ' ' ) && ( cmd[ cmd_name_cntr ] != '|' ) && ( cmd[ cmd_name_cntr ] != '?' ) ){
+	#endif
+
+		cmd_name_cntr++;
+
+	}
+
+	i = cmd_name_cntr;
+
+	// The space separates the command name from its arguments.
+	if( ( i < length ) && ( cmd[ i ] == ' ' ) ){
+
+		i++;
+
+	}
+
+	#ifndef COMMANDER_LEAN
+
+	// The process is the same as above. The only difference is that this time
+	// we have to set the show_description flag.
+	else if( ( i < length ) && ( cmd[ i ] == '?' ) ){
+
+		i++;
+		show_description = 1;
+
+	}
+
+	#endif
+
+	// The arguments last until the pipe or the string-end character.
+	argStart = i;
+
+	while( ( i < length ) && ( cmd[ i ] != '\0' ) && ( cmd[ i ] != '|' ) ){
+
+		i++;
+
+	}
+
+	argLength = i - argStart;
+
+	if( ( i < length ) && ( cmd[ i ] == '|' ) ){
+
+		pipePos = i;
+
+		#ifndef COMMANDER_ENABLE_PIPE_MODULE
+
+			#ifdef __AVR__
+			response -> println( F( "Piping not available on this device!" ) );
+			#else
+			response -> println( (const char*)"Piping not available on this device!" );
+			#endif
+
+			return COMMAND_PIPE_ERROR;
+
+		#endif
+
+	}
+
+	// The name and the arguments have to fit in the internal buffer
+	// with their terminators. A truncated command could do something
+	// else than it was asked for, so it is not executed.
+	if( ( ( cmd_name_cntr + 1 ) > commandSize ) || ( ( argLength > 0 ) && ( ( cmd_name_cntr + argLength + 2 ) > commandSize ) ) ){
+
+		print_too_long();
+
+		#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+		// Clear the pipe at error.
+		pipeChannel.clear();
+
+		#endif
+
+		return COMMAND_TOO_LONG;
+
+	}
+
+	// The search needs a terminated name and the command functions
+	// need modifiable arguments, so only these parts are copied to the
+	// internal buffer. The command can be in the internal buffer, when
+	// a group executes its subcommand, but it is always after the
+	// destination, so the characters are copied before they are overwritten.
+
+	for( i = 0; i < cmd_name_cntr; i++ ){
+
+		// The name is folded once, so the search can compare
+		// it with the lower case keys in case-insensitive mode.
+		tempBuff[ i ] = commander_fold( cmd[ i ] );
+
+	}
+
+	tempBuff[ cmd_name_cntr ] = '\0';
+
+	// Without arguments the terminator of the name is an empty string.
+	arg = &tempBuff[ cmd_name_cntr ];
+
+	if( argLength > 0 ){
+
+		arg = &tempBuff[ cmd_name_cntr + 1 ];
+		memmove( arg, &cmd[ argStart ], argLength );
+		arg[ argLength ] = '\0';
+
+	}
+
+	// Try to find the command datata.
+	commandElement = find_command( tempBuff, cmd_name_cntr, &commandFunc, &commandMemory );
+
+	if( commandElement != NULL ){
+
+		// Because we have found the command in the API tree we have to choose
+		// between description printing and executing.
+		// If show_description flag is set, than we have to print the description.
+		if( show_description ){
+
+			#ifndef COMMANDER_LEAN
+
+			if( commandMemory == MEMORY_REGULAR ){
+
+				// Print the description text to the output channel.
+				response -> print( commandElement -> name );
+				response -> print( ':' );
+				response -> print( ' ' );
+				print_description( commandElement, commandMemory, response );
+				response -> println();
+
+			}
+
+			#ifdef __AVR__
+
+			else if( commandMemory == MEMORY_PROGMEM ){
+
+				// Print the description text to the output channel.
+				response -> print( commandElement -> name_P );
+				response -> print( ':' );
+				response -> print( ' ' );
+				print_description( commandElement, commandMemory, response );
+				response -> println();
+
+			}
+
+			#endif
+
+			#endif
+
+
+		}
+
+		// If show_description flag is not set, than we have to execute the commands function.
+		else{
+
+			// Execute command function. If the command is followed
+			// by a pipe, the output is redirected to the pipe.
+			if( !dispatch( commandFunc, arg, pipePos > 0 ) ){
+
+				return COMMAND_TOO_LONG;
+
+			}
+
+			#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+			if( pipePos > 0 ){
+
+				// To remowe whitespace from the new command begin.
+				while( ( (uint32_t)( pipePos + 1 ) < length ) && ( cmd[ pipePos + 1 ] == ' ' ) ){
+					pipePos++;
+				}
+
+				// The rest of the command is still in the original buffer.
+				return executeCommand( &cmd[ pipePos + 1 ], length - pipePos - 1 );
+
+			}
+
+			#endif
+
+		}
+
+	}
+
+	// If it is not an added function, we have to check for internal functions.
+	// 'help' is an internal function that prints the available commands in order.
+	else if( commander_name_cmp( tempBuff, (const char*)"help" ) == 0 ){
+
+		helpCommand( arg );
+
+	}
+
+	else{
+
+		// If we went through the whole tree and we did not found the command in it,
+		// we have to notice the user abut the problem. Maybe a Type-O
+		#if defined( ARDUINO ) && defined( __AVR__ )
+
+		response -> print( F( "Command \'" ) );
+		response -> print( tempBuff );
+		response -> println( F( "\' not found!" ) );
+
+		#else
+
+		response -> print( (const char*)"Command \'" );
+		response -> print( tempBuff );
+		response -> println( (const char*)"\' not found!" );
+
+		#endif
+
+		#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+		// Clear the pipe at error.
+		while( pipeChannel.available() ){
+
+			pipeChannel.read();
+
+		}
+		
+		#endif
+
+		return COMMAND_NOT_FOUND;
+
+	}
+
+	return COMMAND_OK;
+
+}
+
+void CommanderCore::executeGroup( char *args, Stream *resp ){
+
+	// Skip the spaces before the subcommand.
+	while( *args == ' ' ){
+
+		args++;
+
+	}
+
+	// The group can use a shared index, it can not
+	// be released while the subcommand runs.
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	// Without subcommand the commands of the group are listed.
+	if( *args == '\0' ){
+
+		helpFunction( false, response );
+
+	}
+
+	else{
+
+		executeCommand( args, strlen( args ) );
+
+	}
+
+	shared_unlock( slot );
+
+}
+
+bool CommanderCore::dispatch( commandFunction_t func, char *arg, bool pipeOutput ){
+
+	#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+	// Generic counter variable.
+	uint32_t i;
+
+	if( ( pipeChannel.available() > 0 ) || pipeChannel.overflowed() ){
+
+		i = 0;
+
+		while( pipeChannel.available() ){
+
+			if( i < ( argumentSize - 1 ) ){
+
+				pipeArgBuffer[ i ] = pipeChannel.read();
+
+			}
+
+			else{
+
+				pipeChannel.read();
+
+			}
+
+			i++;
+
+		}
+
+		// The output of the previous stage is lost, if it did not fit
+		// in the pipe or in the argument buffer.
+		if( pipeChannel.overflowed() || ( i > ( argumentSize - 1 ) ) ){
+
+			pipeChannel.clear();
+			print_too_long();
+			return false;
+
+		}
+
+		pipeArgBuffer[ i ] = '\0';
+
+		arg = pipeArgBuffer;
+
+	}
+
+	if( pipeOutput ){
+
+		// Execute commands function and redirect the output to pipe.
+		( func )( arg, &pipeChannel );
+
+	}
+
+	else{
+
+		// Execute command function.
+		( func )( arg, response );
+
+	}
+
+	#else
+
+	( void )pipeOutput;
+
+	// Execute command function.
+	( func )( arg, response );
+
+	#endif
+
+	return true;
+
+}
+
+void CommanderCore::print_too_long(){
+
+	#if defined( ARDUINO ) && defined( __AVR__ )
+
+	response -> println( F( "Command is too long!" ) );
+
+	#else
+
+	response -> println( (const char*)"Command is too long!" );
+
+	#endif
+
+}
+
+bool CommanderCore::prepare( preparedCommandCore_t *prepared, const char *cmd ){
+
+	// The result of the preparation.
+	bool result;
+
+	// The commands of all stages have to come from the same version.
+	uint8_t slot = shared_lock();
+
+	result = prepare_command( prepared, cmd );
+
+	shared_unlock( slot );
+
+	return result;
+
+}
+
+bool CommanderCore::prepare_command( preparedCommandCore_t *prepared, const char *cmd ){
+
+	static_assert( COMMANDER_MAX_PARAMETERS <= 8, "The slots are stored as control characters, at most 8 can be used!" );
+
+	// Name of the slots in the command line.
+	const char *slotNames[ COMMANDER_MAX_PARAMETERS ];
+	uint32_t slotLengths[ COMMANDER_MAX_PARAMETERS ];
+
+	// The found command.
+	API_t *element;
+	commandFunction_t func;
+	memoryType_t elementMemory;
+
+	// Number of the prepared stages.
+	uint8_t stages = 0;
+
+	// Number of used characters in the argument buffer.
+	uint32_t used = 0;
+
+	// Length of the command and the slot names.
+	uint32_t nameLength;
+
+	// The closing brace of a slot.
+	const char *close;
+
+	// Generic counter variable.
+	uint8_t i;
+
+	// Until it is finished, the prepared command does nothing.
+	prepared -> stages = 0;
+	prepared -> parameterCount = 0;
+
+	for( i = 0; i < COMMANDER_MAX_PARAMETERS; i++ ){
+
+		prepared -> parameters[ i ] = "";
+
+	}
+
+	while( true ){
+
+		if( stages >= COMMANDER_MAX_PIPE_STAGES ){
+
+			return false;
+
+		}
+
+		// To remove whitespace from the command begin.
+		while( *cmd == ' ' ){
+
+			cmd++;
+
+		}
+
+		nameLength = 0;
+
+		while( ( cmd[ nameLength ] != '\0' ) && ( cmd[ nameLength ] != ' ' ) && ( cmd[ nameLength ] != '|' ) ){
+
+			nameLength++;
+
+		}
+
+		if( ( nameLength == 0 ) || ( nameLength >= commandSize ) ){
+
+			return false;
+
+		}
+
+		// The search needs a terminated name.
+		for( i = 0; i < nameLength; i++ ){
+
+			tempBuff[ i ] = commander_fold( cmd[ i ] );
+
+		}
+
+		tempBuff[ nameLength ] = '\0';
+
+		element = find_command( tempBuff, nameLength, &func, &elementMemory );
+
+		if( element == NULL ){
+
+			return false;
+
+		}
+
+		prepared -> elements[ stages ] = element;
+		prepared -> funcs[ stages ] = func;
+		prepared -> argStarts[ stages ] = used;
+
+		cmd += nameLength;
+
+		// The space separates the command name from its arguments.
+		if( *cmd == ' ' ){
+
+			cmd++;
+
+		}
+
+		while( ( *cmd != '\0' ) && ( *cmd != '|' ) ){
+
+			// One character has to remain for the terminator.
+			if( used >= ( prepared -> argsSize - 1 ) ){
+
+				return false;
+
+			}
+
+			// These characters are used for the slots.
+			if( (uint8_t)*cmd <= 8 ){
+
+				return false;
+
+			}
+
+			// Find the end of the slot. The name can not contain
+			// separators, otherwise the brace is a regular character.
+			close = cmd + 1;
+
+			while( ( *cmd == '{' ) && ( *close != '}' ) && ( *close != '\0' ) && ( *close != ' ' ) && ( *close != '|' ) && ( *close != '{' ) ){
+
+				close++;
+
+			}
+
+			if( ( *cmd == '{' ) && ( *close == '}' ) ){
+
+				nameLength = close - cmd - 1;
+
+				// The same name is the same slot.
+				for( i = 0; i < prepared -> parameterCount; i++ ){
+
+					if( ( slotLengths[ i ] == nameLength ) && ( strncmp( slotNames[ i ], cmd + 1, nameLength ) == 0 ) ){
+
+						break;
+
+					}
+
+				}
+
+				if( i == prepared -> parameterCount ){
+
+					if( prepared -> parameterCount >= COMMANDER_MAX_PARAMETERS ){
+
+						return false;
+
+					}
+
+					slotNames[ i ] = cmd + 1;
+					slotLengths[ i ] = nameLength;
+					prepared -> parameterCount++;
+
+				}
+
+				// The slots are stored as 1, 2..., these
+				// characters can not be in a command line.
+				prepared -> args[ used ] = (char)( i + 1 );
+				used++;
+				cmd = close + 1;
+				continue;
+
+			}
+
+			prepared -> args[ used ] = *cmd;
+			used++;
+			cmd++;
+
+		}
+
+		prepared -> args[ used ] = '\0';
+		used++;
+
+		stages++;
+
+		if( *cmd == '\0' ){
+
+			break;
+
+		}
+
+		#ifndef COMMANDER_ENABLE_PIPE_MODULE
+
+		// Piping is not available.
+		return false;
+
+		#endif
+
+		// Skip the pipe character.
+		cmd++;
+
+	}
+
+	// The pointers of the commands are valid only in this version.
+	prepared -> version = commandsVersion;
+	prepared -> stages = stages;
+	return true;
+
+}
+
+bool CommanderCore::setParameter( preparedCommandCore_t *prepared, uint8_t slot, const char *value ){
+
+	if( slot >= prepared -> parameterCount ){
+
+		return false;
+
+	}
+
+	prepared -> parameters[ slot ] = value;
+	return true;
+
+}
+
+CommanderCore::commandStatus_t CommanderCore::executePrepared( preparedCommandCore_t *prepared ){
+
+	commandStatus_t status;
+
+	uint8_t slot = shared_lock();
+
+	// Default execute handler, so the default response will be chosen.
+	response = &defaultResponse;
+
+	status = execute_prepared( prepared );
+
+	shared_unlock( slot );
+
+	return status;
+
+}
+
+CommanderCore::commandStatus_t CommanderCore::executePrepared( preparedCommandCore_t *prepared, Stream *resp ){
+
+	commandStatus_t status;
+
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	status = execute_prepared( prepared );
+
+	shared_unlock( slot );
+
+	return status;
+
+}
+
+uint32_t CommanderCore::executeBatch( const char *script, Stream *resp, commandStatus_t *statuses, uint32_t statusSize, bool stopOnError ){
+
+	// Number of executed commands.
+	uint32_t count = 0;
+
+	// The end of the actual command.
+	const char *end;
+
+	// Quoted arguments can contain separators.
+	bool quoted;
+
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	while( true ){
+
+		end = script;
+		quoted = false;
+
+		while( ( *end != '\0' ) && ( quoted || ( ( *end != ';' ) && ( *end != '\n' ) ) ) ){
+
+			if( *end == '\"' ){
+
+				quoted = !quoted;
+
+			}
+
+			end++;
+
+		}
+
+		// The commands are executed in place, without copying.
+		if( !batch_command( script, end - script, statuses, statusSize, &count, stopOnError ) || ( *end == '\0' ) ){
+
+			break;
+
+		}
+
+		script = end + 1;
+
+	}
+
+	shared_unlock( slot );
+
+	return count;
+
+}
+
+uint32_t CommanderCore::executeBatch( Stream *script, Stream *resp, commandStatus_t *statuses, uint32_t statusSize, bool stopOnError ){
+
+	// Number of executed commands.
+	uint32_t count = 0;
+
+	// Length of the actual command in the command buffer.
+	uint32_t length = 0;
+
+	// The next character from the channel.
+	char c;
+
+	// The batch is finished.
+	bool end;
+
+	// Quoted arguments can contain separators.
+	bool quoted = false;
+
+	// The command did not fit in the buffer.
+	bool overflow = false;
+
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	while( true ){
+
+		// readBytes waits for the next character until the timeout of
+		// the channel, so a short gap in the data does not end the batch.
+		// The end of transmission character ends it without waiting.
+		end = ( script -> readBytes( &c, 1 ) != 1 ) || ( c == '\x04' );
+
+		if( end || ( !quoted && ( ( c == ';' ) || ( c == '\n' ) ) ) ){
+
+			if( overflow ){
+
+				// The truncated command is not executed.
+				print_too_long();
+
+				if( count < statusSize ){
+
+					statuses[ count ] = COMMAND_TOO_LONG;
+
+				}
+
+				count++;
+
+				if( stopOnError ){
+
+					break;
+
+				}
+
+			}
+
+			// The command is collected in the command buffer. The execution
+			// copies the name and the arguments to the beginning of the same
+			// buffer, but they are never behind the copied characters.
+			else if( !batch_command( tempBuff, length, statuses, statusSize, &count, stopOnError ) ){
+
+				break;
+
+			}
+
+			if( end ){
+
+				break;
+
+			}
+
+			length = 0;
+			quoted = false;
+			overflow = false;
+			continue;
+
+		}
+
+		if( c == '\"' ){
+
+			quoted = !quoted;
+
+		}
+
+		if( length < commandSize ){
+
+			tempBuff[ length ] = c;
+			length++;
+
+		}
+
+		else{
+
+			overflow = true;
+
+		}
+
+	}
+
+	shared_unlock( slot );
+
+	return count;
+
+}
+
+bool CommanderCore::batch_command( const char *cmd, uint32_t length, commandStatus_t *statuses, uint32_t statusSize, uint32_t *count, bool stopOnError ){
+
+	commandStatus_t status;
+
+	// Remove the spaces and the line endings around the command.
+	while( ( length > 0 ) && ( ( *cmd == ' ' ) || ( *cmd == '\t' ) || ( *cmd == '\r' ) ) ){
+
+		cmd++;
+		length--;
+
+	}
+
+	while( ( length > 0 ) && ( ( cmd[ length - 1 ] == ' ' ) || ( cmd[ length - 1 ] == '\t' ) || ( cmd[ length - 1 ] == '\r' ) ) ){
+
+		length--;
+
+	}
+
+	// Empty lines are skipped.
+	if( length == 0 ){
+
+		return true;
+
+	}
+
+	status = executeCommand( cmd, length );
+
+	if( *count < statusSize ){
+
+		statuses[ *count ] = status;
+
+	}
+
+	( *count )++;
+
+	return !( stopOnError && ( status != COMMAND_OK ) );
+
+}
+
+uint32_t CommanderCore::update( Stream *channel, uint32_t byteBudget, uint32_t timeBudget ){
+
+	// Number of executed commands.
+	uint32_t count = 0;
+
+	// Start time of the call for the time budget.
+	uint32_t startTime = millis();
+
+	// Number of bytes, that can be read in one step.
+	int available;
+
+	// Number of bytes read in one step.
+	uint32_t received;
+
+	// The actual character of the line buffer.
+	char c;
+
+	// Length of a truncated line.
+	uint32_t truncated;
+
+	uint8_t slot;
+
+	// Only the objects with a line buffer can assemble the lines.
+	if( line == NULL ){
+
+		return 0;
+
+	}
+
+	slot = shared_lock();
+
+	response = channel;
+
+	while( true ){
+
+		// Execute the complete lines from the buffer.
+		while( line -> checked < line -> length ){
+
+			c = line -> buffer[ line -> checked ];
+
+			if( ( c != '\r' ) && ( c != '\n' ) ){
+
+				line -> checked++;
+				continue;
+
+			}
+
+			// The end of a too long line only finishes the discarding.
+			if( line -> discard ){
+
+				line -> discard = false;
+
+			}
+
+			// The empty lines are skipped, so "\r\n" is one line ending.
+			else if( line -> checked > 0 ){
+
+				executeCommand( line -> buffer, line -> checked );
+				count++;
+
+			}
+
+			// Remove the line and its ending from the buffer.
+			line -> length -= line -> checked + 1;
+			memmove( line -> buffer, &line -> buffer[ line -> checked + 1 ], line -> length );
+			line -> checked = 0;
+
+			// The remaining lines are kept for the next call.
+			if( ( timeBudget > 0 ) && ( ( millis() - startTime ) >= timeBudget ) ){
+
+				shared_unlock( slot );
+				return count;
+
+			}
+
+		}
+
+		// The dropped characters do not have to be stored.
+		if( line -> discard ){
+
+			line -> length = 0;
+			line -> checked = 0;
+
+		}
+
+		// The buffer is full, but there is no line ending in it.
+		else if( line -> length >= line -> size ){
+
+			// One character has to remain for the terminator.
+			if( line -> policy == OVERFLOW_TRUNCATE ){
+
+				truncated = ( line -> size < commandSize ) ? line -> size : commandSize;
+				executeCommand( line -> buffer, truncated - 1 );
+				count++;
+
+			}
+
+			else{
+
+				print_too_long();
+
+			}
+
+			// The rest of the line is dropped.
+			line -> discard = true;
+			line -> length = 0;
+			line -> checked = 0;
+
+		}
+
+		available = channel -> available();
+
+		if( ( available <= 0 ) || ( byteBudget == 0 ) ){
+
+			break;
+
+		}
+
+		// Only the available bytes are read, so readBytes does not wait.
+		received = line -> size - line -> length;
+
+		if( (uint32_t)available < received ){
+
+			received = available;
+
+		}
+
+		if( byteBudget < received ){
+
+			received = byteBudget;
+
+		}
+
+		received = channel -> readBytes( &line -> buffer[ line -> length ], received );
+
+		if( received == 0 ){
+
+			break;
+
+		}
+
+		line -> length += received;
+		byteBudget -= received;
+
+	}
+
+	shared_unlock( slot );
+
+	return count;
+
+}
+
+CommanderCore::commandStatus_t CommanderCore::execute_prepared( preparedCommandCore_t *prepared ){
+
+	// The actual pipeline stage.
+	uint8_t stage;
+
+	// The next character of the stored arguments.
+	const char *source;
+
+	// Value of a slot.
+	const char *value;
+
+	// Number of characters in the argument buffer.
+	uint32_t used;
+
+	// The arguments do not fit in the internal buffer.
+	bool overflow;
+
+	// The commands of the prepared pipeline can be removed since then.
+	if( prepared -> version != commandsVersion ){
+
+		#if defined( ARDUINO ) && defined( __AVR__ )
+
+		response -> println( F( "Prepared command is outdated!" ) );
+
+		#else
+
+		response -> println( (const char*)"Prepared command is outdated!" );
+
+		#endif
+
+		return COMMAND_OUTDATED;
+
+	}
+
+	for( stage = 0; stage < prepared -> stages; stage++ ){
+
+		source = &prepared -> args[ prepared -> argStarts[ stage ] ];
+		used = 0;
+		overflow = false;
+
+		// The command functions can modify the arguments, so they
+		// are assembled in the internal buffer with the slot values.
+		// One character has to remain for the terminator.
+		while( ( *source != '\0' ) && !overflow ){
+
+			if( (uint8_t)*source <= COMMANDER_MAX_PARAMETERS ){
+
+				value = NULL;
+
+				// Only the existing slots have values.
+				if( (uint8_t)*source <= prepared -> parameterCount ){
+
+					value = prepared -> parameters[ *source - 1 ];
+
+				}
+
+				while( ( value != NULL ) && ( *value != '\0' ) && !overflow ){
+
+					if( used >= ( commandSize - 1 ) ){
+
+						overflow = true;
+
+					}
+
+					else{
+
+						tempBuff[ used ] = *value;
+						used++;
+						value++;
+
+					}
+
+				}
+
+			}
+
+			else if( used >= ( commandSize - 1 ) ){
+
+				overflow = true;
+
+			}
+
+			else{
+
+				tempBuff[ used ] = *source;
+				used++;
+
+			}
+
+			source++;
+
+		}
+
+		// The slot values made the arguments too long.
+		if( overflow ){
+
+			print_too_long();
+
+			#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+			// Clear the pipe at error.
+			pipeChannel.clear();
+
+			#endif
+
+			return COMMAND_TOO_LONG;
+
+		}
+
+		tempBuff[ used ] = '\0';
+
+		if( !dispatch( prepared -> funcs[ stage ], tempBuff, ( stage + 1 ) < prepared -> stages ) ){
+
+			return COMMAND_TOO_LONG;
+
+		}
+
+	}
+
+	return COMMAND_OK;
+
+}
+
+uint32_t CommanderCore::findIndexPrefix( const char *prefix, uint32_t *first ){
+
+	// Number of matching commands.
+	uint32_t count;
+
+	uint8_t slot = shared_lock();
+
+	count = find_prefix( prefix, first );
+
+	shared_unlock( slot );
+
+	return count;
+
+}
+
+uint32_t CommanderCore::find_prefix( const char *prefix, uint32_t *first ){
+
+	// The first element of the interval, where the searched border can be.
+	uint32_t base;
+
+	// The size of the interval.
+	uint32_t size;
+
+	// Half of the interval.
+	uint32_t half;
+
+	// The first place that is not smaller than the prefix.
+	uint32_t lower;
+
+	// The first place after the commands that start with the prefix.
+	uint32_t upper;
+
+	uint32_t length;
+
+	*first = 0;
+
+	if( index.size == 0 ){
+
+		return 0;
+
+	}
+
+	length = strlen( prefix );
+
+	// Find the first command that is not smaller than the prefix.
+	// It works the same way as the search, but the interval is
+	// halved until only one element left.
+	base = 0;
+	size = index.size;
+
+	while( size > 1 ){
+
+		half = size / 2;
+		base = ( commander_strcmp_tree_ram( index.names[ base + half ], prefix ) < 0 ) ? ( base + half ) : base;
+		size -= half;
+
+	}
+
+	lower = base + ( ( commander_strcmp_tree_ram( index.names[ base ], prefix ) < 0 ) ? 1 : 0 );
+
+	// Find the first command after the ones that start with the prefix.
+	base = 0;
+	size = index.size;
+
+	while( size > 1 ){
+
+		half = size / 2;
+		base = ( commander_strncmp_tree_ram( index.names[ base + half ], prefix, length ) <= 0 ) ? ( base + half ) : base;
+		size -= half;
+
+	}
+
+	upper = base + ( ( commander_strncmp_tree_ram( index.names[ base ], prefix, length ) <= 0 ) ? 1 : 0 );
+
+	if( upper <= lower ){
+
+		return 0;
+
+	}
+
+	*first = lower;
+	return upper - lower;
+
+}
+
+uint32_t CommanderCore::autoComplete( const char *prefix, char *buffer, uint32_t bufferSize ){
+
+	// Number of matching commands.
+	uint32_t count;
+
+	uint8_t slot = shared_lock();
+
+	count = auto_complete( prefix, buffer, bufferSize );
+
+	shared_unlock( slot );
+
+	return count;
+
+}
+
+uint32_t CommanderCore::auto_complete( const char *prefix, char *buffer, uint32_t bufferSize ){
+
+	// Number of the matching commands.
+	uint32_t count;
+
+	// Place of the first matching command.
+	uint32_t first;
+
+	// Generic counter variable.
+	uint32_t i;
+
+	// The characters of the first and the last matching command.
+	char firstChar;
+	char lastChar;
+
+	// Length of the prefix.
+	uint32_t length;
+
+	// Traversal of the dynamic command tree.
+	commandNode_t *stack[ COMMANDER_DYNAMIC_MAX_HEIGHT ];
+	uint8_t depth = 0;
+	commandNode_t *node;
+
+	// Name of the actual dynamic command.
+	const char *name;
+
+	if( bufferSize == 0 ){
+
+		return 0;
+
+	}
+
+	buffer[ 0 ] = '\0';
+
+	count = find_prefix( prefix, &first );
+
+	// The commands are in alphabetical order, so the common part of
+	// the first and the last matching command is common for all of them.
+	// In case-insensitive mode the order is by the lower case names,
+	// so the folded characters are compared and copied.
+	for( i = 0; ( count > 0 ) && ( i < ( bufferSize - 1 ) ); i++ ){
+
+		#ifdef __AVR__
+
+		if( memoryType == MEMORY_PROGMEM ){
+
+			firstChar = pgm_read_byte( &index.names[ first ][ i ] );
+			lastChar = pgm_read_byte( &index.names[ first + count - 1 ][ i ] );
+
+		}
+
+		else
+
+		#endif
+
+		{
+
+			firstChar = index.names[ first ][ i ];
+			lastChar = index.names[ first + count - 1 ][ i ];
+
+		}
+
+		firstChar = commander_fold( firstChar );
+		lastChar = commander_fold( lastChar );
+
+		if( ( firstChar == '\0' ) || ( firstChar != lastChar ) ){
+
+			break;
+
+		}
+
+		buffer[ i ] = firstChar;
+
+	}
+
+	if( count > 0 ){
+
+		buffer[ i ] = '\0';
+
+	}
+
+	// The matching dynamic commands can only shorten the common part.
+	length = strlen( prefix );
+
+	dynamic_seek( prefix, stack, &depth );
+	node = dynamic_next( stack, &depth );
+
+	while( ( node != NULL ) && ( commander_name_ncmp( node -> element -> name, prefix, length ) == 0 ) ){
+
+		name = node -> element -> name;
+
+		if( count == 0 ){
+
+			for( i = 0; ( name[ i ] != '\0' ) && ( i < ( bufferSize - 1 ) ); i++ ){
+
+				buffer[ i ] = commander_fold( name[ i ] );
+
+			}
+
+			buffer[ i ] = '\0';
+
+		}
+
+		else{
+
+			i = 0;
+
+			while( ( buffer[ i ] != '\0' ) && ( buffer[ i ] == commander_fold( name[ i ] ) ) ){
+
+				i++;
+
+			}
+
+			buffer[ i ] = '\0';
+
+		}
+
+		count++;
+		node = dynamic_next( stack, &depth );
+
+	}
+
+	return count;
+
+}
+
+void CommanderCore::execute( char *cmd ){
+
+	// The index can not be released while the command runs.
+	uint8_t slot = shared_lock();
+
+	// Default execute handler, so the default response will be chosen.
+	response = &defaultResponse;
+
+	// Execute the command.
+	executeCommand( cmd, strlen( cmd ) );
+
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::execute( const char *cmd ){
+
+	// The index can not be released while the command runs.
+	uint8_t slot = shared_lock();
+
+	// Default execute handler, so the default response will be chosen.
+	response = &defaultResponse;
+
+	// Execute the command.
+	executeCommand( cmd, strlen( cmd ) );
+
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::execute( char *cmd, Stream *resp ){
+
+	// The index can not be released while the command runs.
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	// Execute the command.
+	executeCommand( cmd, strlen( cmd ) );
+
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::execute( const char *cmd, Stream *resp ){
+
+	// The index can not be released while the command runs.
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	// Execute the command.
+	executeCommand( cmd, strlen( cmd ) );
+
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::executeLength( const char *cmd, size_t length ){
+
+	// The index can not be released while the command runs.
+	uint8_t slot = shared_lock();
+
+	// Default execute handler, so the default response will be chosen.
+	response = &defaultResponse;
+
+	// Execute the command.
+	executeCommand( cmd, length );
+
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::executeLength( const char *cmd, size_t length, Stream *resp ){
+
+	// The index can not be released while the command runs.
+	uint8_t slot = shared_lock();
+
+	response = resp;
+
+	// Execute the command.
+	executeCommand( cmd, length );
+
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::attachDebugChannel( Stream *resp ){
+
+	dbgResponse = resp;
+
+	// Enable debug messages.
+	debugEnabled = true;
+
+}
+
+void CommanderCore::setOverflowPolicy( overflowPolicy_t policy ){
+
+	if( line != NULL ){
+
+		line -> policy = policy;
+
+	}
+
+}
+
+void CommanderCore::enableDebug(){
+
+	debugEnabled = true;
+
+}
+
+void CommanderCore::disableDebug(){
+
+	debugEnabled = false;
+
+}
+
+CommanderCore::API_t* CommanderCore::operator [] ( int i ){
+
+	// The element of the command.
+	API_t *element = NULL;
+
+	uint8_t slot = shared_lock();
+
+	// Detect wrong addressing.
+	if( ( i >= 0 ) && ( i < (int)index.size ) ){
+
+		element = (API_t*)index.elements[ i ];
+
+	}
+
+	shared_unlock( slot );
+
+	return element;
+
+}
+
+CommanderCore::API_t* CommanderCore::operator [] ( char* name ){
+
+	// Function of the command, it is not used here.
+	commandFunction_t func;
+
+	// Memory type of the command, it is not used here.
+	memoryType_t elementMemory;
+
+	// The found command.
+	API_t *element;
+
+	uint8_t slot = shared_lock();
+
+	element = find_command( name, strlen( name ), &func, &elementMemory );
+
+	shared_unlock( slot );
+
+	return element;
+
+}
+
+CommanderCore::API_t* CommanderCore::operator [] ( const char* name ){
+
+	return (*this)[ (char*)name ];
+
+}
+
+void CommanderCore::attachNodePoolFunction( commandNode_t *pool, uint32_t size ){
+
+	uint32_t i;
+
+	dynamicRoot = NULL;
+	dynamicFree = NULL;
+	commands_changed();
+
+	// The free nodes are chained with their left pointers.
+	for( i = 0; i < size; i++ ){
+
+		pool[ i ].element = NULL;
+		pool[ i ].right = NULL;
+		pool[ i ].height = 0;
+		pool[ i ].left = dynamicFree;
+
+		dynamicFree = &pool[ i ];
+
+	}
+
+}
+
+bool CommanderCore::addCommand( API_t *element ){
+
+	// The new node from the pool.
+	commandNode_t *node;
+
+	// Alphabetical place of the name in the index.
+	int32_t place;
+
+	// The reader counter of the shared index.
+	uint8_t slot;
+
+	if( ( element == NULL ) || ( element -> name == NULL ) ){
+
+		return false;
+
+	}
+
+	// The name has to be unique in the API-tree and in the dynamic tree as well.
+	slot = shared_lock();
+	place = search_index( element -> name, strlen( element -> name ) );
+	shared_unlock( slot );
+
+	if( ( place >= 0 ) || ( dynamic_search( element -> name ) != NULL ) ){
+
+		if( debugEnabled ){
+
+			#if defined( ARDUINO ) && defined( __AVR__ )
+
+			dbgResponse -> print( F( "Command \'" ) );
+			dbgResponse -> print( element -> name );
+			dbgResponse -> println( F( "\' already exists!" ) );
+
+			#else
+
+			dbgResponse -> print( (const char*)"Command \'" );
+			dbgResponse -> print( element -> name );
+			dbgResponse -> println( (const char*)"\' already exists!" );
+
+			#endif
+
+		}
+
+		return false;
+
+	}
+
+	if( dynamicFree == NULL ){
+
+		if( debugEnabled ){
+
+			#if defined( ARDUINO ) && defined( __AVR__ )
+
+			dbgResponse -> println( F( "Node pool is empty!" ) );
+
+			#else
+
+			dbgResponse -> println( (const char*)"Node pool is empty!" );
+
+			#endif
+
+		}
+
+		return false;
+
+	}
+
+	// Take the first free node from the pool.
+	node = dynamicFree;
+	dynamicFree = node -> left;
+
+	node -> element = element;
+	node -> left = NULL;
+	node -> right = NULL;
+	node -> height = 1;
+
+	dynamicRoot = dynamic_insert( dynamicRoot, node );
+
+	commands_changed();
+
+	return true;
+
+}
+
+bool CommanderCore::removeCommand( const char *name ){
+
+	// The removed node.
+	commandNode_t *node = NULL;
+
+	dynamicRoot = dynamic_remove( dynamicRoot, name, &node );
+
+	if( node == NULL ){
+
+		return false;
+
+	}
+
+	commands_changed();
+
+	// Give back the node to the pool.
+	node -> element = NULL;
+	node -> right = NULL;
+	node -> height = 0;
+	node -> left = dynamicFree;
+
+	dynamicFree = node;
+
+	return true;
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_search( const char *name ){
+
+	commandNode_t *node = dynamicRoot;
+
+	int result;
+
+	while( node != NULL ){
+
+		result = commander_name_cmp( name, node -> element -> name );
+
+		if( result == 0 ){
+
+			return node;
+
+		}
+
+		node = ( result < 0 ) ? node -> left : node -> right;
+
+	}
+
+	return NULL;
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_insert( commandNode_t *node, commandNode_t *newNode ){
+
+	if( node == NULL ){
+
+		return newNode;
+
+	}
+
+	if( commander_name_cmp( newNode -> element -> name, node -> element -> name ) < 0 ){
+
+		node -> left = dynamic_insert( node -> left, newNode );
+
+	}
+
+	else{
+
+		node -> right = dynamic_insert( node -> right, newNode );
+
+	}
+
+	return dynamic_balance( node );
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_remove( commandNode_t *node, const char *name, commandNode_t **removed ){
+
+	// The node that takes the place of the removed one.
+	commandNode_t *min;
+
+	int result;
+
+	if( node == NULL ){
+
+		return NULL;
+
+	}
+
+	result = commander_name_cmp( name, node -> element -> name );
+
+	if( result < 0 ){
+
+		node -> left = dynamic_remove( node -> left, name, removed );
+
+	}
+
+	else if( result > 0 ){
+
+		node -> right = dynamic_remove( node -> right, name, removed );
+
+	}
+
+	else{
+
+		*removed = node;
+
+		if( node -> left == NULL ){
+
+			return node -> right;
+
+		}
+
+		if( node -> right == NULL ){
+
+			return node -> left;
+
+		}
+
+		// The node has two children, so it is replaced
+		// with the smallest node of the right subtree.
+		node -> right = dynamic_remove_min( node -> right, &min );
+
+		min -> left = node -> left;
+		min -> right = node -> right;
+
+		node = min;
+
+	}
+
+	return dynamic_balance( node );
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_remove_min( commandNode_t *node, commandNode_t **min ){
+
+	if( node -> left == NULL ){
+
+		*min = node;
+		return node -> right;
+
+	}
+
+	node -> left = dynamic_remove_min( node -> left, min );
+
+	return dynamic_balance( node );
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_balance( commandNode_t *node ){
+
+	// Height difference between the left and the right subtree.
+	int difference;
+
+	dynamic_update( node );
+
+	difference = (int)dynamic_height( node -> left ) - (int)dynamic_height( node -> right );
+
+	// The left subtree is too high.
+	if( difference > 1 ){
+
+		if( dynamic_height( node -> left -> left ) < dynamic_height( node -> left -> right ) ){
+
+			node -> left = dynamic_rotate_left( node -> left );
+
+		}
+
+		return dynamic_rotate_right( node );
+
+	}
+
+	// The right subtree is too high.
+	if( difference < -1 ){
+
+		if( dynamic_height( node -> right -> right ) < dynamic_height( node -> right -> left ) ){
+
+			node -> right = dynamic_rotate_right( node -> right );
+
+		}
+
+		return dynamic_rotate_left( node );
+
+	}
+
+	return node;
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_rotate_left( commandNode_t *node ){
+
+	commandNode_t *right = node -> right;
+
+	node -> right = right -> left;
+	right -> left = node;
+
+	dynamic_update( node );
+	dynamic_update( right );
+
+	return right;
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_rotate_right( commandNode_t *node ){
+
+	commandNode_t *left = node -> left;
+
+	node -> left = left -> right;
+	left -> right = node;
+
+	dynamic_update( node );
+	dynamic_update( left );
+
+	return left;
+
+}
+
+uint8_t CommanderCore::dynamic_height( commandNode_t *node ){
+
+	if( node == NULL ){
+
+		return 0;
+
+	}
+
+	return node -> height;
+
+}
+
+void CommanderCore::dynamic_update( commandNode_t *node ){
+
+	uint8_t left = dynamic_height( node -> left );
+	uint8_t right = dynamic_height( node -> right );
+
+	node -> height = ( ( left > right ) ? left : right ) + 1;
+
+}
+
+void CommanderCore::dynamic_seek( const char *prefix, commandNode_t **stack, uint8_t *depth ){
+
+	commandNode_t *node = dynamicRoot;
+
+	// Only the nodes that are not smaller than the prefix are
+	// pushed, they are the next ones in the traversal.
+	while( node != NULL ){
+
+		if( commander_name_cmp( node -> element -> name, prefix ) >= 0 ){
+
+			stack[ *depth ] = node;
+			( *depth )++;
+			node = node -> left;
+
+		}
+
+		else{
+
+			node = node -> right;
+
+		}
+
+	}
+
+}
+
+CommanderCore::commandNode_t* CommanderCore::dynamic_next( commandNode_t **stack, uint8_t *depth ){
+
+	commandNode_t *node;
+	commandNode_t *next;
+
+	if( *depth == 0 ){
+
+		return NULL;
+
+	}
+
+	( *depth )--;
+	node = stack[ *depth ];
+
+	// The next nodes are the left chain of the right subtree.
+	next = node -> right;
+
+	while( next != NULL ){
+
+		stack[ *depth ] = next;
+		( *depth )++;
+		next = next -> left;
+
+	}
+
+	return node;
+
+}
+
+#ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+void CommanderCore::attachHelpBuffer( char *buffer, uint32_t size, bool cache ){
+
+	helpBuffer = buffer;
+	helpBufferSize = size;
+	helpCacheEnabled = cache;
+	helpCacheValid = false;
+
+	// Without memory the buffer can not be used.
+	if( size == 0 ){
+
+		helpBuffer = NULL;
+
+	}
+
+}
+
+#endif
+
+void CommanderCore::helpFunction( bool description ){
+
+	helpFunction( description, response );
+
+}
+
+void CommanderCore::helpFunction( bool description, Stream* out, bool style, const char *prefix, uint32_t page ){
+
+	#ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+	// Only the full listing is cached, the filtered and paged ones are not.
+	bool cacheable = helpCacheEnabled && ( ( prefix == NULL ) || ( *prefix == '\0' ) ) && ( page == 0 );
+
+	// Output channel that collects the help text in the help buffer.
+	commanderBufferedChannel helpChannel;
+
+	// Without buffer the output goes directly to the channel.
+	if( helpBuffer == NULL ){
+
+		help_render( description, out, style, prefix, page );
+		return;
+
+	}
+
+	// The same text was generated before, it can be written in one piece.
+	if( cacheable && helpCacheValid && ( helpCacheDescription == description ) && ( helpCacheStyle == style ) ){
+
+		out -> write( (const uint8_t*)helpBuffer, helpCacheLength );
+		return;
+
+	}
+
+	// The buffer will be overwritten, so the cached text is lost.
+	helpCacheValid = false;
+
+	helpChannel.begin( out, (uint8_t*)helpBuffer, helpBufferSize );
+	help_render( description, &helpChannel, style, prefix, page );
+
+	// If the whole text fits in the buffer, it can be reused.
+	if( cacheable && !helpChannel.overflowed() ){
+
+		helpCacheValid = true;
+		helpCacheDescription = description;
+		helpCacheStyle = style;
+		helpCacheLength = helpChannel.length();
+
+	}
+
+	helpChannel.flushBuffer();
+
+	#else
+
+	help_render( description, out, style, prefix, page );
+
+	#endif
+
+}
+
+void CommanderCore::help_render( bool description, Print* out, bool style, const char *prefix, uint32_t page ){
+
+	// Alphabetical place of the next command from the search index.
+	uint32_t place;
+
+	// Place of the first matching command in the search index.
+	uint32_t first = 0;
+
+	// Number of the matching commands in the search index.
+	uint32_t count = index.size;
+
+	// Number of all matching commands.
+	uint32_t total;
+
+	// Number of the pages.
+	uint32_t pageCount;
+
+	// Only the commands between these positions are printed.
+	uint32_t start = 0;
+	uint32_t stop;
+
+	// Position of the actual command in the listing.
+	uint32_t position;
+
+	// Length of the prefix.
+	uint32_t length;
+
+	// Traversal of the dynamic command tree.
+	commandNode_t *stack[ COMMANDER_DYNAMIC_MAX_HEIGHT ];
+	uint8_t depth = 0;
+	commandNode_t *node;
+
+	if( prefix == NULL ){
+
+		prefix = "";
+
+	}
+
+	length = strlen( prefix );
+
+	// The matching commands are next to each other,
+	// so only this interval has to be printed.
+	if( length > 0 ){
+
+		count = find_prefix( prefix, &first );
+
+	}
+
+	// The matching dynamic commands have to be counted for the paging.
+	total = count;
+
+	dynamic_seek( prefix, stack, &depth );
+	node = dynamic_next( stack, &depth );
+
+	while( ( node != NULL ) && ( commander_name_ncmp( node -> element -> name, prefix, length ) == 0 ) ){
+
+		total++;
+		node = dynamic_next( stack, &depth );
+
+	}
+
+	pageCount = ( total + COMMANDER_HELP_PAGE_SIZE - 1 ) / COMMANDER_HELP_PAGE_SIZE;
+	stop = total;
+
+	if( page > 0 ){
+
+		if( page > pageCount ){
+
+			stop = 0;
+
+		}
+
+		else{
+
+			start = ( page - 1 ) * COMMANDER_HELP_PAGE_SIZE;
+
+			if( ( stop - start ) > COMMANDER_HELP_PAGE_SIZE ){
+
+				stop = start + COMMANDER_HELP_PAGE_SIZE;
+
+			}
+
+		}
+
+	}
+
+	#ifdef COMMANDER_LEAN
+
+	// The lean profile only prints the names without style.
+	description = false;
+	style = false;
+
+	#endif
+
+	if( style ){
+
+		#ifndef COMMANDER_LEAN
+
+		#if defined( ARDUINO ) && defined( __AVR__ )
+
+		out -> println( F( "\033[1;31m----\033[1;32m Available commands \033[1;31m----\033[0;37m\r\n" ) );
+
+		#else
 
 		out -> println( (const char*)"\033[1;31m----\033[1;32m Available commands \033[1;31m----\033[0;37m\r\n" );
 
 		#endif
 
+		#endif
+
+	}
+
+	else{
+
+		#if defined( ARDUINO ) && defined( __AVR__ )
+
+		out -> println( F( "---- Available commands ----\r\n" ) );
+
+		#else
+
+		out -> println( (const char*)"---- Available commands ----\r\n" );
+
+		#endif
+
+	}
+
+	// Both the search index and the dynamic command tree are in
+	// alphabetical order, so they have to be merged like in merge sort.
+	place = first;
+	depth = 0;
+
+	dynamic_seek( prefix, stack, &depth );
+	node = dynamic_next( stack, &depth );
+
+	for( position = 0; position < stop; position++ ){
+
+		if( ( node != NULL ) && ( commander_name_ncmp( node -> element -> name, prefix, length ) != 0 ) ){
+
+			node = NULL;
+
+		}
+
+		// Take the dynamic command if it comes before the next command from the index.
+		if( ( node != NULL ) && ( ( place >= ( first + count ) ) || ( commander_strcmp_tree_ram( index.names[ place ], node -> element -> name ) > 0 ) ) ){
+
+			if( position >= start ){
+
+				helpElement( node -> element, MEMORY_REGULAR, description, out, style );
+
+			}
+
+			node = dynamic_next( stack, &depth );
+
+		}
+
+		else{
+
+			if( position >= start ){
+
+				if( is_alias( place ) ){
+
+					helpAlias( place, description, out, style );
+
+				}
+
+				else{
+
+					helpElement( (API_t*)index.elements[ place ], memoryType, description, out, style );
+
+				}
+
+			}
+
+			place++;
+
+		}
+
+	}
+
+	if( page > 0 ){
+
+		#if defined( ARDUINO ) && defined( __AVR__ )
+
+		out -> print( F( "---- Page " ) );
+		out -> print( page );
+		out -> print( '/' );
+		out -> print( pageCount );
+		out -> println( F( " ----" ) );
+
+		#else
+
+		out -> print( (const char*)"---- Page " );
+		out -> print( page );
+		out -> print( '/' );
+		out -> print( pageCount );
+		out -> println( (const char*)" ----" );
+
+		#endif
+
+	}
+
+}
+
+void CommanderCore::helpAlias( uint32_t place, bool description, Print* out, bool style ){
+
+	#ifndef COMMANDER_LEAN
+
+	if( style ){
+
+		#if defined( ARDUINO ) && defined( __AVR__ )
+
+		out -> print( F( "\033[1;32m" ) );
+
+		#else
+
+		out -> print( (const char*)"\033[1;32m" );
+
+		#endif
+
+	}
+
+	#endif
+
+	if( memoryType == MEMORY_REGULAR ){
+
+		out -> print( index.names[ place ] );
+
+	}
+
+	#ifdef __AVR__
+
+	else if( memoryType == MEMORY_PROGMEM ){
+
+		out -> print( (const __FlashStringHelper*)index.names[ place ] );
+
 	}
 
-	else{
+	#endif
+
+	#ifndef COMMANDER_LEAN
+
+	if( style ){
 
 		#if defined( ARDUINO ) && defined( __AVR__ )
 
-		out -> println( F( "---- Available commands ----\r\n" ) );
+		out -> print( F( "\033[0;37m" ) );
 
 		#else
 
-		out -> println( (const char*)"---- Available commands ----\r\n" );
+		out -> print( (const char*)"\033[0;37m" );
 
 		#endif
 
 	}
 
-	for( i = 0; i < API_tree_size; i++ ){
+	#endif
 
-		for( j = 0; j < API_tree_size; j++ ){
+	#if defined( ARDUINO ) && defined( __AVR__ )
 
-			if( API_tree[ j ].place == i ){
+	out -> print( F( " -> " ) );
 
-				// Check if the description is required to print.
-				if( description ){
+	#else
 
-					// Check if style is enabled.
-					if( style ){
+	out -> print( (const char*)" -> " );
 
-						if( memoryType == MEMORY_REGULAR ){
+	#endif
 
-							out -> print( (const char*)"\033[1;32m" );
-							out -> print( API_tree[ j ].name );
-							out -> print( (const char*)"\033[0;37m" );
-							out -> print( ':' );
-							out -> print( ' ' );
-							out -> print( API_tree[ j ].desc );
-							out -> println();
+	if( memoryType == MEMORY_REGULAR ){
 
-						}
+		out -> println( index.elements[ place ] -> name );
 
-						#ifdef __AVR__
+	}
 
-						else if( memoryType == MEMORY_PROGMEM ){
+	#ifdef __AVR__
 
-							out -> print( F( "\033[1;32m" ) );
-							out -> print( API_tree[ j ].name_P );
-							out -> print( F( "\033[0;37m" ) );
-							out -> print( ':' );
-							out -> print( ' ' );
-							out -> print( API_tree[ j ].desc_P );
-							out -> println();
-							out -> println();
+	else if( memoryType == MEMORY_PROGMEM ){
 
-						}
+		out -> println( index.elements[ place ] -> name_P );
 
-						#endif
+	}
 
-					}
+	#endif
 
-					else{
+	#ifndef COMMANDER_LEAN
 
-						if( memoryType == MEMORY_REGULAR ){
+	// Keep the same layout as the commands with description.
+	if( description && !style ){
 
-							out -> print( API_tree[ j ].name );
-							out -> println( ':' );
-							out -> print( '\t' );
-							out -> print( API_tree[ j ].desc );
-							out -> println();
-							out -> println();
+		out -> println();
 
-						}
+	}
 
-						#ifdef __AVR__
+	#endif
 
-						else if( memoryType == MEMORY_PROGMEM ){
+}
 
-							out -> print( API_tree[ j ].name_P );
-							out -> println( ':' );
-							out -> print( '\t' );
-							out -> print( API_tree[ j ].desc_P );
-							out -> println();
-							out -> println();
+void CommanderCore::helpElement( API_t *element, memoryType_t elementMemory, bool description, Print* out, bool style ){
 
-						}
+	#ifdef COMMANDER_LEAN
 
-						#endif
+	// There is no description in the lean profile.
+	( void )description;
+	( void )style;
 
-					}
+	#else
 
-				}
+	// Check if the description is required to print.
+	if( description ){
 
-				else{
+		// Check if style is enabled.
+		if( style ){
 
-					if( memoryType == MEMORY_REGULAR ){
+			if( elementMemory == MEMORY_REGULAR ){
 
-						out -> println( API_tree[ j ].name );
+				out -> print( (const char*)"\033[1;32m" );
+				out -> print( element -> name );
+				out -> print( (const char*)"\033[0;37m" );
+				out -> print( ':' );
+				out -> print( ' ' );
+				print_description( element, elementMemory, out );
+				out -> println();
 
-					}
+			}
 
-					#ifdef __AVR__
+			#ifdef __AVR__
 
-					else if( memoryType == MEMORY_PROGMEM ){
+			else if( elementMemory == MEMORY_PROGMEM ){
 
-						out -> println( API_tree[ j ].name_P );
+				out -> print( F( "\033[1;32m" ) );
+				out -> print( element -> name_P );
+				out -> print( F( "\033[0;37m" ) );
+				out -> print( ':' );
+				out -> print( ' ' );
+				print_description( element, elementMemory, out );
+				out -> println();
+				out -> println();
 
-					}
+			}
+
+			#endif
+
+		}
+
+		else{
+
+			if( elementMemory == MEMORY_REGULAR ){
+
+				out -> print( element -> name );
+				out -> println( ':' );
+				out -> print( '\t' );
+				print_description( element, elementMemory, out );
+				out -> println();
+				out -> println();
+
+			}
+
+			#ifdef __AVR__
+
+			else if( elementMemory == MEMORY_PROGMEM ){
+
+				out -> print( element -> name_P );
+				out -> println( ':' );
+				out -> print( '\t' );
+				print_description( element, elementMemory, out );
+				out -> println();
+				out -> println();
+
+			}
+
+			#endif
+
+		}
+
+		return;
+
+	}
+
+	#endif
+
+	if( elementMemory == MEMORY_REGULAR ){
+
+		out -> println( element -> name );
+
+	}
+
+	#ifdef __AVR__
+
+	else if( elementMemory == MEMORY_PROGMEM ){
+
+		out -> println( element -> name_P );
+
+	}
+
+	#endif
+
+}
+
+#ifndef COMMANDER_LEAN
+
+#ifdef COMMANDER_COMPRESSED_DESCRIPTIONS
+
+// The phrases of the dictionary in token order.
+#ifdef __AVR__
+static const char commander_dictionary[] PROGMEM = COMMANDER_DICTIONARY_TEXT;
+#else
+static const char commander_dictionary[] = COMMANDER_DICTIONARY_TEXT;
+#endif
+
+#endif
+
+void CommanderCore::print_description( API_t *element, memoryType_t elementMemory, Print* out ){
+
+	#ifdef COMMANDER_COMPRESSED_DESCRIPTIONS
+
+	// The expanded characters are collected in this buffer.
+	char chunk[ COMMANDER_DESCRIPTION_CHUNK_SIZE ];
+
+	// Number of characters in the chunk.
+	uint8_t chunkSize = 0;
+
+	// Address of the next character of the description.
+	const char *desc;
+
+	// Address of the next character of the actual phrase.
+	// It is NULL, when there is no phrase to expand.
+	const char *phrase = NULL;
+
+	// Generic counter variable.
+	uint8_t i;
+
+	// The actual character.
+	uint8_t c;
+
+	#ifdef __AVR__
+
+	if( elementMemory == MEMORY_PROGMEM ){
+
+		desc = (const char*)element -> desc_P;
+
+	}
+
+	else{
+
+		desc = element -> desc;
+
+	}
+
+	#else
+
+	( void )elementMemory;
+	desc = element -> desc;
+
+	#endif
+
+	while( true ){
+
+		// Expand the actual phrase first.
+		if( phrase != NULL ){
+
+			#ifdef __AVR__
+			c = pgm_read_byte( phrase );
+			#else
+			c = *phrase;
+			#endif
+
+			phrase++;
+
+			if( c == '\0' ){
+
+				phrase = NULL;
+				continue;
+
+			}
+
+		}
+
+		else{
+
+			#ifdef __AVR__
+
+			if( elementMemory == MEMORY_PROGMEM ){
+
+				c = pgm_read_byte( desc );
+
+			}
+
+			else{
+
+				c = *desc;
+
+			}
 
+			#else
+
+			c = *desc;
+
+			#endif
+
+			desc++;
+
+			if( c == '\0' ){
+
+				break;
+
+			}
+
+			// Find the phrase of the token. The phrases are
+			// terminated, so the n-th one starts after n terminators.
+			if( ( c >= COMMANDER_DICT_TOKEN_FIRST ) && ( c < COMMANDER_DICT_TOKEN_FIRST + COMMANDER_DICT_TOKEN_COUNT ) ){
+
+				phrase = commander_dictionary;
+
+				for( i = COMMANDER_DICT_TOKEN_FIRST; i < c; i++ ){
+
+					#ifdef __AVR__
+					while( pgm_read_byte( phrase ) != '\0' ){
+					#else
+					while( *phrase != '\0' ){
 					#endif
 
+						phrase++;
+
+					}
+
+					phrase++;
+
 				}
 
 				continue;
@@ -790,60 +4399,228 @@ void Commander::helpFunction( bool description, Stream* out, bool style ){
 
 		}
 
+		chunk[ chunkSize ] = c;
+		chunkSize++;
+
+		// The chunk is full, write it to the channel.
+		if( chunkSize >= COMMANDER_DESCRIPTION_CHUNK_SIZE ){
+
+			out -> write( (const uint8_t*)chunk, chunkSize );
+			chunkSize = 0;
+
+		}
+
+	}
+
+	// Write the rest of the description.
+	if( chunkSize > 0 ){
+
+		out -> write( (const uint8_t*)chunk, chunkSize );
+
+	}
+
+	#else
+
+	#ifdef __AVR__
+
+	if( elementMemory == MEMORY_PROGMEM ){
+
+		out -> print( element -> desc_P );
+		return;
+
 	}
 
+	#else
+
+	( void )elementMemory;
+
+	#endif
+
+	out -> print( element -> desc );
+
+	#endif
+
 }
 
-int32_t Commander::hasChar( char* str, char c ){
+#endif
+
+void CommanderCore::helpCommand( char *args ){
+
+	// Start of the actual argument.
+	char *token;
+
+	// The description flag.
+	bool description = false;
+
+	// The prefix filter.
+	char *prefix = NULL;
+
+	// The selected page.
+	uint32_t page = 0;
+
+	// This flag is set when the next argument is the page number.
+	bool pageNext = false;
+
+	while( *args != '\0' ){
+
+		// Skip the spaces between the arguments.
+		while( *args == ' ' ){
+
+			args++;
+
+		}
+
+		if( *args == '\0' ){
+
+			break;
+
+		}
+
+		// Find the end of the argument and terminate it.
+		token = args;
+
+		while( ( *args != '\0' ) && ( *args != ' ' ) ){
+
+			args++;
+
+		}
+
+		if( *args == ' ' ){
+
+			*args = '\0';
+			args++;
+
+		}
+
+		if( pageNext ){
+
+			page = strtoul( token, NULL, 10 );
+			pageNext = false;
+
+		}
+
+		else if( strcmp( token, (const char*)"-d" ) == 0 ){
 
-	int32_t cntr = 0;
+			description = true;
 
-	while( str[ cntr ] ){
+		}
 
-		if( str[ cntr ] == c ){
+		else if( strcmp( token, (const char*)"-p" ) == 0 ){
 
-			return cntr;
+			pageNext = true;
 
 		}
 
-		cntr++;
+		else{
+
+			// The wildcard at the end of the prefix is optional.
+			if( token[ strlen( token ) - 1 ] == '*' ){
+
+				token[ strlen( token ) - 1 ] = '\0';
+
+			}
+
+			prefix = token;
+
+		}
 
 	}
 
-	return -1;
+	helpFunction( description, response, false, prefix, page );
 
 }
 
-void Commander::printHelp( Stream* out ){
+void CommanderCore::printHelp( Stream* out ){
+
+	uint8_t slot = shared_lock();
 
 	helpFunction( true, out, true );
 
+	shared_unlock( slot );
+
+}
+
+void CommanderCore::printHelp( Stream* out, const char *prefix, uint32_t page ){
+
+	uint8_t slot = shared_lock();
+
+	helpFunction( true, out, true, prefix, page );
+
+	shared_unlock( slot );
+
+}
+
+int CommanderCore::commander_strcmp_tree_ram( const char* element1, const char* element2 ){
+
+	#ifdef __AVR__
+
+	if( memoryType == MEMORY_PROGMEM ){
+
+		return commander_strcmp_tree_ram_progmem( element1, element2 );
+
+	}
+
+	#endif
+
+	return commander_strcmp_tree_ram_regular( element1, element2 );
+
+}
+
+int CommanderCore::commander_strncmp_tree_ram( const char* element1, const char* element2, size_t length ){
+
+	#ifdef __AVR__
+
+	if( memoryType == MEMORY_PROGMEM ){
+
+		return commander_strncmp_tree_ram_progmem( element1, element2, length );
+
+	}
+
+	#endif
+
+	return commander_strncmp_tree_ram_regular( element1, element2, length );
+
 }
 
-int Commander::commander_strcmp_regular( API_t* element1, API_t* element2 ){
+int CommanderCore::commander_strcmp_tree_ram_regular( const char* element1, const char* element2 ){
 
-	return strcmp( element1 -> name, element2 -> name );
+	return commander_name_cmp( element1, element2 );
 
 }
 
-int Commander::commander_strcmp_tree_ram_regular( API_t* element1, char* element2 ){
+int CommanderCore::commander_strncmp_tree_ram_regular( const char* element1, const char* element2, size_t length ){
 
-	return strcmp( element1 -> name, element2 );
+	return commander_name_ncmp( element1, element2, length );
 
 }
 
 #ifdef __AVR__
 
-int Commander::commander_strcmp_progmem( API_t* element1, API_t* element2 ){
+int CommanderCore::commander_strcmp_tree_ram_progmem( const char* element1, const char* element2 ){
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+
+	return strcasecmp_P( element2, (PGM_P)element1 ) * -1;
+
+	#else
+
+	return strcmp_P( element2, (PGM_P)element1 ) * -1;
 
-	strncpy_P( progmemBuffer, (	PGM_P ) element1 -> name_P, COMMANDER_MAX_COMMAND_SIZE );
-	return strcmp_P( progmemBuffer, (	PGM_P )element2 -> name_P );
+	#endif
 
 }
 
-int Commander::commander_strcmp_tree_ram_progmem( API_t* element1, char* element2 ){
+int CommanderCore::commander_strncmp_tree_ram_progmem( const char* element1, const char* element2, size_t length ){
+
+	#ifdef COMMANDER_CASE_INSENSITIVE
+
+	return strncasecmp_P( element2, (PGM_P)element1, length ) * -1;
 
-	return strcmp_P( element2, (PGM_P)element1 -> name_P ) * -1;
+	#else
+
+	return strncmp_P( element2, (PGM_P)element1, length ) * -1;
+
+	#endif
 
 }
 
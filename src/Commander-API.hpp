@@ -38,10 +38,15 @@ SOFTWARE.
 #define COMMANDER_API_VERSION (const char*)"2.1.0"
 
 #include "stdint.h"
+#include "stdlib.h"
 #include "string.h"
 
 #include "Commander-Settings.hpp"
+#include "Commander-Dictionary.hpp"
 #include "Commander-IO.hpp"
+#include "Commander-Arguments.hpp"
+#include "Commander-Number.hpp"
+#include "Commander-Bind.hpp"
 
 /// Arduino detection
 #ifdef ARDUINO
@@ -50,6 +55,12 @@ SOFTWARE.
 
 #include "Stream.h"
 
+#ifdef COMMANDER_ENABLE_SHARED_INDEX
+#include <atomic>
+#include <mutex>
+#include <thread>
+#endif
+
 #ifdef COMMANDER_USE_WIFI_CLIENT_RESPONSE
 	#ifdef ESP8266
 	#include <ESP8266WiFi.h>
@@ -67,7 +78,41 @@ SOFTWARE.
 /// This macro simplifies the API element creation.
 ///
 /// With this macro you can fill the API tree structure easily.
-#define apiElement( name, desc, func ) { 0, NULL, NULL, (const char*)name, (const char*)desc, func }
+/// In the lean profile the description is dropped, so the text
+/// is not compiled to the binary.
+#ifdef COMMANDER_LEAN
+#define apiElement( name, desc, func ) { (const char*)name, func }
+#else
+#define apiElement( name, desc, func ) { (const char*)name, (const char*)desc, func }
+#endif
+
+/// This macro simplifies the alias creation.
+///
+/// The alias is a second name for a command. The command is
+/// selected by its place in the API-tree array.
+#define apiAlias( name, command ) { (const char*)name, command }
+
+/// This macro simplifies the command group creation.
+///
+/// A group is a command that passes the rest of the command
+/// line to another Commander object. For example 'wifi scan'
+/// executes the 'scan' command of the wifi group. The group
+/// has to be a global Commander or CommanderSized object.
+#define apiGroup( name, desc, group ) apiElement( name, desc, ( Commander::groupHandler< decltype( group ), &group > ) )
+
+/// This macro creates a command from a regular function.
+///
+/// The arguments are parsed and checked by the types of the
+/// parameters, and the return value is printed to the response.
+/// For example int add( int a, int b ) can be used as 'add 1 2'.
+/// @note The function can not be overloaded, because its type is deduced.
+#define apiBind( name, desc, function ) apiElement( name, desc, ( commanderBinding< decltype( &function ), &function >::handler ) )
+
+/// This macro simplifies the weight profile creation.
+///
+/// The lines printed by exportWeights have this format, so
+/// they can be pasted to a commandWeight_t array.
+#define apiWeight( name, weight ) { (const char*)name, weight }
 
 #ifdef __AVR__
 
@@ -75,8 +120,46 @@ SOFTWARE.
 ///
 /// With this macro you can fill the API tree structure easily.
 /// It is used for PROGMEM implementation.
+#ifdef COMMANDER_LEAN
+#define apiElement_P( element, name, desc, func_arg ) { element.name_P = F( name ); element.func = func_arg; }
+#else
 #define apiElement_P( element, name, desc, func_arg ) { element.name_P = F( name ); element.desc_P = F( desc ); element.func = func_arg; }
+#endif
+
+/// This macro creates a command from a regular function for PROGMEM implementation.
+#define apiBind_P( element, name, desc, function ) apiElement_P( element, name, desc, ( commanderBinding< decltype( &function ), &function >::handler ) )
+
+#endif
+
+/// The search index stores the name lengths on one byte.
+/// Longer names are stored as 255 and the string comparison
+/// decides in that case.
+#define commander_name_length( length ) ( ( length ) > 255 ? 255 : ( length ) )
+
+/// Name comparison macros.
+///
+/// In case-insensitive mode the characters are folded to lower
+/// case, and the names are compared with strcasecmp. Otherwise
+/// they are the regular functions, so they cost nothing.
+#ifdef COMMANDER_CASE_INSENSITIVE
+#define commander_fold( c ) ( ( (uint8_t)( (uint8_t)( c ) - 'A' ) < 26 ) ? (char)( ( c ) | 0x20 ) : (char)( c ) )
+#define commander_name_cmp( name1, name2 ) strcasecmp( name1, name2 )
+#define commander_name_ncmp( name1, name2, length ) strncasecmp( name1, name2, length )
+#else
+#define commander_fold( c ) ( c )
+#define commander_name_cmp( name1, name2 ) strcmp( name1, name2 )
+#define commander_name_ncmp( name1, name2, length ) strncmp( name1, name2, length )
+#endif
 
+/// Word type for the name comparison.
+///
+/// The names are compared by words instead of characters.
+/// On 64-bit platforms 8 characters are compared at once,
+/// on the others 4 characters.
+#if defined( UINTPTR_MAX ) && ( UINTPTR_MAX > 0xFFFFFFFFUL )
+typedef uint64_t commanderWord_t;
+#else
+typedef uint32_t commanderWord_t;
 #endif
 
 /// This macro simplifies the attachment of the API-tree.
@@ -85,7 +168,43 @@ SOFTWARE.
 /// class easier and faster than with attachTreeFunction.
 #define attachTree( name ) attachTreeFunction( name, sizeof( name ) / sizeof( name[ 0 ] ) )
 
-/// Commander class.
+/// This macro simplifies the attachment of more API-trees.
+///
+/// With this macro you can add another API-tree to the
+/// class easier than with appendTreeFunction.
+#define appendTree( name ) appendTreeFunction( name, sizeof( name ) / sizeof( name[ 0 ] ) )
+
+/// This macro simplifies the attachment of the aliases.
+///
+/// With this macro you can attach the alias array to
+/// the class easier than with attachAliasesFunction.
+#define attachAliases( name ) attachAliasesFunction( name, sizeof( name ) / sizeof( name[ 0 ] ) )
+
+/// This macro simplifies the attachment of the node pool.
+///
+/// With this macro you can attach the node pool for the
+/// dynamic commands easier than with attachNodePoolFunction.
+#define attachNodePool( name ) attachNodePoolFunction( name, sizeof( name ) / sizeof( name[ 0 ] ) )
+
+/// Maximum height of the dynamic command tree.
+///
+/// The tree is an AVL tree, so with this height it can store
+/// more than 5 million commands. The in-order traversal uses
+/// a stack with this many elements.
+#define COMMANDER_DYNAMIC_MAX_HEIGHT 32
+
+/// Empty child in the weighted search tree.
+#define COMMANDER_WEIGHT_NONE 0xFFFF
+
+#ifdef COMMANDER_ENABLE_HASH_TABLE
+
+/// Compile time hash table. It is declared in Commander-Hash.hpp.
+template< uint32_t N >
+class commanderHashTable;
+
+#endif
+
+/// Commander core class.
 ///
 /// This class can be used to create a command parser.
 /// Its job is to parse a command from a character
@@ -94,71 +213,426 @@ SOFTWARE.
 /// an array of API_t-type elements, and these elements
 /// are store the relevant information for that specific
 /// command.
-class Commander{
+/// The buffers are not part of this class, they are
+/// provided by the CommanderSized template below, so
+/// the objects can have different command sizes. The
+/// Commander type uses the default sizes.
+class CommanderCore{
 
 public:
 
 	/// Library version string.
 	static const char *version;
 
+	/// Function pointer type for the command functions.
+	typedef void( *commandFunction_t )( char *args, Stream *response );
+
 	/// Structure for command data
 	///
 	/// Every command will get a structure like this.
-	/// This structure is used to store your commands
-	/// in a balanced binary tree.
+	/// The search structure is stored separately in
+	/// the search index, this structure only holds
+	/// the data of the command.
 	typedef struct API_t{
 
-	  uint16_t place;                                   //  This will store the alphabetical place of the command in the tree
-	  struct API_t *left;                               //  Left element on a binary tree branch
-	  struct API_t *right;                              //  Right element on a binary tree branch
 	  const char *name;                                 //  Name of the command
+
+		#ifndef COMMANDER_LEAN
 	  const char *desc;                                 //  Description of the command
+		#endif
 
 	  void(*func)( char*, Stream *response );  					//  Function pointer to the command function
 
 		#ifdef __AVR__
 		__FlashStringHelper *name_P;											// Name of the command( stored in PROGMEM )
+
+		#ifndef COMMANDER_LEAN
 		__FlashStringHelper *desc_P;											// Description of the command( stored in PROGMEM )
 		#endif
+		#endif
 
 	}API_t;
 
+	/// Structure for alias data.
+	///
+	/// An alias is a second name for a command. It is searched
+	/// like the commands, but it executes the command from the
+	/// API-tree, so the description is not duplicated.
+	typedef struct commandAlias_t{
+
+		const char *name;			// Name of the alias. With PROGMEM API-tree it has to be stored in PROGMEM as well
+		uint16_t command;			// Place of the command in the API-tree array
+
+	}commandAlias_t;
+
+	/// Structure for an attached API-tree.
+	///
+	/// More API-trees can be attached to one object, for
+	/// example the premade commands and the commands of
+	/// the application. They are merged in the search index.
+	typedef struct commandTree_t{
+
+		const API_t *tree;		// Starting address of the API-tree
+		uint32_t size;				// Number of elements in the API-tree
+
+	}commandTree_t;
+
+	/// Structure for a prepared command.
+	///
+	/// The commands of the pipeline are searched only once, when the
+	/// command is prepared, so it can be executed many times without
+	/// the parsing and the search. The {name} parameters in the arguments
+	/// are slots, they can be set before every execution. It is provided
+	/// by the user, so preparing a command does not allocate memory.
+	/// It holds pointers to the commands, so it is valid only until the
+	/// command set of the object changes. After that it is refused, and
+	/// it has to be prepared again.
+	/// The argument buffer is provided by the preparedCommandSized_t
+	/// template, the preparedCommand_t type of an object has the same
+	/// size as its command buffer.
+	typedef struct preparedCommandCore_t{
+
+		API_t *elements[ COMMANDER_MAX_PIPE_STAGES ];								// The commands of the pipeline stages
+		commandFunction_t funcs[ COMMANDER_MAX_PIPE_STAGES ];				// Function of the commands
+		uint16_t argStarts[ COMMANDER_MAX_PIPE_STAGES ];						// Start of the arguments of the stages in args
+		uint8_t stages;																							// Number of pipeline stages
+		char *args;																									// Terminated arguments, the slots are stored as 1, 2...
+		uint32_t argsSize;																					// Size of the argument buffer in bytes
+		const char *parameters[ COMMANDER_MAX_PARAMETERS ];					// Value of the slots
+		uint8_t parameterCount;																			// Number of different slots
+		uint32_t version;																						// Version of the command set at preparation
+
+	}preparedCommandCore_t;
+
+	/// Prepared command with its own argument buffer.
+	///
+	/// The arguments of all stages are stored in the buffer with
+	/// their terminators.
+	/// @tparam argumentsBufferSize Size of the argument buffer in bytes.
+	template< uint32_t argumentsBufferSize >
+	struct preparedCommandSized_t : public preparedCommandCore_t{
+
+		static_assert( argumentsBufferSize >= 2, "The argument buffer needs space for a character and the terminator!" );
+		static_assert( argumentsBufferSize <= 65536, "The start of the arguments are stored on 16 bits!" );
+
+		preparedCommandSized_t(){
+
+			stages = 0;
+			parameterCount = 0;
+			version = 0;
+			args = buffer;
+			argsSize = argumentsBufferSize;
+			buffer[ 0 ] = '\0';
+
+		}
+
+		// The copy has to use its own buffer.
+		preparedCommandSized_t( const preparedCommandSized_t &other ) : preparedCommandCore_t( other ){
+
+			memcpy( buffer, other.buffer, argumentsBufferSize );
+			args = buffer;
+
+		}
+
+		preparedCommandSized_t& operator=( const preparedCommandSized_t &other ){
+
+			preparedCommandCore_t::operator=( other );
+			memcpy( buffer, other.buffer, argumentsBufferSize );
+			args = buffer;
+			return *this;
+
+		}
+
+	private:
+
+		char buffer[ argumentsBufferSize ];
+
+	};
+
+	/// Structure for the weight profile.
+	///
+	/// It stores the usage count of a command. The profile can
+	/// be exported from a running system and imported at boot.
+	typedef struct commandWeight_t{
+
+		const char *name;			// Name of the command
+		uint32_t weight;			// Usage count of the command
+
+	}commandWeight_t;
+
 	enum memoryType_t{
 		MEMORY_REGULAR,		///< Regular memory implementation
 		MEMORY_PROGMEM		///< Progmem memory implementation
 	};
 
+	/// Result of a command execution.
+	enum commandStatus_t{
+		COMMAND_OK,					///< The command is executed
+		COMMAND_NOT_FOUND,	///< The command is not found
+		COMMAND_PIPE_ERROR,	///< Piping is not available
+		COMMAND_TOO_LONG,		///< The command does not fit in the buffer
+		COMMAND_OUTDATED		///< The command set changed since the command was prepared
+	};
+
+	/// Handling of the too long lines in the update function.
+	enum overflowPolicy_t{
+		OVERFLOW_DISCARD,		///< The line is dropped and an error message is printed
+		OVERFLOW_TRUNCATE		///< The beginning of the line is executed
+	};
+
+	/// Structure for the line assembler of the update function.
+	///
+	/// It is provided with the line buffer by the CommanderSized
+	/// template, only the objects with a line buffer have it.
+	typedef struct lineState_t{
+
+		char *buffer;								// The incoming line is collected in this buffer
+		uint32_t size;							// Size of the buffer in bytes
+		uint32_t length;						// Number of characters in the buffer
+		uint32_t checked;						// Number of characters, that are checked for the line ending
+		bool discard;								// The rest of the actual line has to be dropped
+		overflowPolicy_t policy;		// Handling of the too long lines
+
+	}lineState_t;
+
 	/// Flag for memory type.
 	memoryType_t memoryType = MEMORY_REGULAR;
 
+	/// Search index of an API-tree.
+	///
+	/// It is stored as a structure of arrays in alphabetical order.
+	/// The search only reads the names, the lengths, the prefix words
+	/// and the fingerprints, the descriptions stay in the API-tree,
+	/// so they are not loaded to the cache during the search.
+	/// The index is never modified after it is created, so more
+	/// Commander objects can use the same index.
+	typedef struct commandIndex_t{
+
+		const API_t * const *elements;			// The API-tree elements in alphabetical order
+		const char * const *names;					// Names of the commands
+		const uint8_t *lengths;							// Length of the names, see commander_name_length
+		const commandFunction_t *funcs;			// Function of the commands
+		const commanderWord_t *prefixes;		// The first characters of the names packed to a word in big-endian order
+		const uint8_t *fingerprints;				// 8-bit hash of the names
+		uint32_t size;											// Number of commands
+		memoryType_t memoryType;						// Memory type of the API-tree
+		void *memory;												// Memory area of the arrays, allocated by createIndex
+
+		#ifdef COMMANDER_CASE_INSENSITIVE
+		const char * const *keys;						// Lower case names. Only the names with upper case characters are copied
+		#endif
+
+	}commandIndex_t;
+
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
+
+	/// A published version of a shared index.
+	typedef struct sharedVersion_t{
+
+		commandIndex_t index;					// The search index of this version
+		uint32_t version;							// Number of the version. It is never 0
+
+	}sharedVersion_t;
+
+	/// Publication point of a search index, shared between tasks.
+	///
+	/// Every task uses its own Commander object, and the objects
+	/// read the same index through this structure. The lookups
+	/// never block. A new index is published atomically with the
+	/// publishIndex function, and the old one is released after
+	/// every lookup that could see it is finished.
+	typedef struct sharedIndex_t{
+
+		std::atomic< sharedVersion_t* > current{ NULL };	// The published version
+		std::atomic< uint32_t > readers[ 2 ] = {};				// Number of the readers in the two epochs
+		std::atomic< uint32_t > epoch{ 0 };								// The epoch of the new readers
+		uint32_t version = 0;															// Number of the last published version
+		std::mutex writer;																// Only one version is published at once
+
+	}sharedIndex_t;
+
+	#endif
+
+	/// Node of the dynamic command tree.
+	///
+	/// The commands added at runtime are stored in an AVL tree.
+	/// The nodes are provided by the user in an array, so adding
+	/// a command does not allocate memory from the heap.
+	typedef struct commandNode_t{
+
+		API_t *element;									// The command that belongs to the node
+		struct commandNode_t *left;			// Left child. In the pool it points to the next free node
+		struct commandNode_t *right;		// Right child
+		uint8_t height;									// Height of the subtree
+
+	}commandNode_t;
+
+	/// Command function of the command groups.
+	///
+	/// It executes the arguments as a command in the group.
+	/// Without arguments it lists the commands of the group.
+	/// @note There is a macro( apiGroup ) to simplify the usage.
+	template< typename groupType, groupType *group >
+	static void groupHandler( char *args, Stream *resp ){
+
+		group -> executeGroup( args, resp );
+
+	}
+
 	/// Attach API-tree to the object.
 	///
 	/// With this function you can attach the API-tree
 	/// structure array to the object. This array contains
 	/// the data for each command.
 	/// @note There is a macro( attachTree ) to simplify this process.
-	void attachTreeFunction(  API_t *API_tree_p, uint32_t API_tree_size_p );
+	/// The API-tree is not modified by the object, so it
+	/// can be stored in read only memory.
+	void attachTreeFunction( const API_t *API_tree_p, uint32_t API_tree_size_p );
+
+	/// Attach one more API-tree to the object.
+	///
+	/// The previously attached API-trees are kept, and the init
+	/// function merges all of them into one search index. If a
+	/// name is used in more trees, the command from the tree that
+	/// was attached first is used, and the init function reports
+	/// the others on the debug channel.
+	/// @note There is a macro( appendTree ) to simplify this process.
+	/// @param API_tree_p Starting address of the API-tree. It is not modified.
+	/// @param API_tree_size_p Number of elements in the API-tree.
+	/// @returns True if the tree is attached. At most COMMANDER_MAX_ATTACHED_TREES trees can be attached.
+	bool appendTreeFunction( const API_t *API_tree_p, uint32_t API_tree_size_p );
+
+	/// Attach aliases to the object.
+	///
+	/// The aliases are added to the search index by the init
+	/// function, so they are found as fast as the commands.
+	/// The aliases that point outside of the API-tree are ignored.
+	/// If more API-trees are attached, the place of the command
+	/// is counted as if the trees were one array, in the order
+	/// they were attached.
+	/// @note There is a macro( attachAliases ) to simplify this process.
+	/// @param aliases_p Array of the aliases. It has to be valid while the object is used.
+	/// @param size Number of aliases.
+	void attachAliasesFunction( const commandAlias_t *aliases_p, uint32_t size );
+
+	/// Create a search index from an API-tree.
+	///
+	/// The index is allocated in the heap and the API-tree is not
+	/// modified. It can be attached to more objects with the
+	/// attachIndex function, so every object does not need its own copy.
+	/// @param index The created index will be stored here.
+	/// @param tree The API-tree. It has to be valid while the index is used.
+	/// @param size Number of elements in the API-tree.
+	/// @param aliases The aliases of the commands. It can be NULL.
+	/// @param aliasCount Number of aliases.
+	/// @returns True if the memory for the index could be allocated.
+	static bool createIndex( commandIndex_t *index, const API_t *tree, uint32_t size, const commandAlias_t *aliases = NULL, uint32_t aliasCount = 0 );
+
+	/// Create a search index from more API-trees.
+	///
+	/// Every tree and the aliases are sorted separately, then they
+	/// are merged into one index with a k-way merge. The trees are
+	/// not modified and not copied, only pointers are stored. If a
+	/// name is found more than once, the first one is kept in the
+	/// order of the trees, and the aliases are the last.
+	/// @param index The created index will be stored here.
+	/// @param trees The API-trees. They have to be valid while the index is used.
+	/// @param treeCount Number of API-trees. It can not be more than COMMANDER_MAX_TREE_COUNT.
+	/// @param aliases The aliases of the commands. It can be NULL.
+	/// @param aliasCount Number of aliases.
+	/// @param report The names that are dropped as duplicates are printed here. It can be NULL.
+	/// @returns True if the index is created.
+	static bool createIndex( commandIndex_t *index, const commandTree_t *trees, uint32_t treeCount, const commandAlias_t *aliases = NULL, uint32_t aliasCount = 0, Print *report = NULL );
+
+	/// Release the memory of a search index, created by createIndex.
+	/// @param index The index that has to be released.
+	static void freeIndex( commandIndex_t *index );
+
+	/// Attach a search index to the object.
+	///
+	/// The index is only read by the object, so the same index
+	/// can be attached to more objects. The init function does
+	/// not have to be called after this function.
+	/// @param index_p The index created by createIndex. It has to be valid while the object is used.
+	void attachIndex( const commandIndex_t *index_p );
+
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
+
+	/// Attach a shared index to the object.
+	///
+	/// Every lookup of the object uses the latest published
+	/// version of the index. The object must be used by only
+	/// one task, but more objects can share the same index.
+	/// The init function detaches the shared index.
+	/// @param shared The publication point of the index.
+	void attachSharedIndex( sharedIndex_t *shared );
+
+	/// Publish a new version of a shared index.
+	///
+	/// The new version is visible for the next lookups. The function
+	/// waits until every lookup that started with an older version is
+	/// finished, then it releases the old version with freeIndex. The
+	/// readers are never blocked. Because of the waiting it must not
+	/// be called from a command function of an object, that uses the
+	/// same shared index.
+	/// @param shared The publication point of the index.
+	/// @param index The new index created by createIndex. The shared index takes its memory. NULL publishes an empty index.
+	/// @returns True if the index is published. It fails if the memory can not be allocated.
+	static bool publishIndex( sharedIndex_t *shared, const commandIndex_t *index );
+
+	#endif
+
+	#ifdef COMMANDER_ENABLE_HASH_TABLE
+
+	/// Attach a compile time hash table to the object.
+	///
+	/// The table can be created with the apiHashTable macro
+	/// from Commander-Hash.hpp. The table is generated by the
+	/// compiler, so the init function does not have to do anything.
+	/// The command search costs one hash calculation and one
+	/// string comparison.
+	/// @param table The hash table created by the apiHashTable macro.
+	template< uint32_t N >
+	void attachHashTable( const commanderHashTable< N > &table );
+
+	/// Attach a compile time hash table to the object.
+	///
+	/// @note There is a template function( attachHashTable ) to simplify this process.
+	/// @param elements Pointers to the API-tree elements in alphabetical order.
+	/// @param size Number of elements.
+	/// @param names Names of the elements in alphabetical order.
+	/// @param lengths Length of the names in alphabetical order.
+	/// @param funcs Function of the elements in alphabetical order.
+	/// @param seeds Displacement value for every bucket.
+	/// @param bucketCount Number of buckets.
+	/// @param slots Alphabetical place of the command for every slot.
+	void attachHashTableFunction( const API_t * const *elements, uint32_t size, const char * const *names, const uint8_t *lengths, const commandFunction_t *funcs, const uint16_t *seeds, uint32_t bucketCount, const uint16_t *slots );
+
+	#endif
 
 	/// Initializer.
 	///
 	/// This function initializes the object and its internal parts.
-	/// Firstly it makes the API-tree alphabetically ordered, then
-	/// creates a balanced binary tree from it. It is necessary to
-	/// speed up the search process.
+	/// It creates a compact search index in alphabetical order from
+	/// the API-tree. It is necessary to speed up the search process.
 	void init();
 
+	/// Destructor. It releases the search index created by init.
+	~CommanderCore();
+
 	/// Array index operator overload for int type.
 	///
 	/// With this function you can get a pointer to an element
 	/// from the API-tree by it's index. If the index is invalid,
-	/// the return value will be NULL.
+	/// the return value will be NULL. The dynamic commands
+	/// can not be accessed by index.
 	API_t* operator [] ( int i );
 
 	/// Array index operator overload for char array( string ).
 	///
 	/// With this function you can get a pointer to an element
-	/// from the API-tree by it's name. If the name is not found
-	/// the return value will be NULL.
+	/// from the API-tree or from the dynamic commands by it's name.
+	/// If the name is not found the return value will be NULL.
 	API_t* operator [] ( char* name );
 
 	/// Array index operator overload for const char array( string ).
@@ -168,6 +642,60 @@ public:
 	/// the return value will be NULL.
 	API_t* operator [] ( const char* name );
 
+	/// Find the commands of the search index that start with a prefix.
+	///
+	/// The commands are stored in alphabetical order, so
+	/// the matching commands are next to each other. They
+	/// can be accessed with the array index operator from
+	/// the first place, without any memory allocation.
+	/// The dynamic commands are not in the search index, so
+	/// they are not counted. The autoComplete function counts
+	/// them as well.
+	/// @param prefix The beginning of the command names.
+	/// @param first The alphabetical place of the first matching command will be stored here.
+	/// @returns The number of matching commands in the search index.
+	uint32_t findIndexPrefix( const char *prefix, uint32_t *first );
+
+	/// Auto complete function.
+	///
+	/// It finds the longest common prefix of the commands
+	/// that start with the prefix. It can be used for tab
+	/// completion in a terminal. The dynamic commands are
+	/// included as well. In case-insensitive mode the common
+	/// prefix is copied in lower case.
+	/// @param prefix The beginning of the command name.
+	/// @param buffer The longest common prefix will be copied to this buffer.
+	/// @param bufferSize The size of the buffer in bytes.
+	/// @returns The number of matching commands.
+	uint32_t autoComplete( const char *prefix, char *buffer, uint32_t bufferSize );
+
+	/// Attach a node pool for the dynamic commands.
+	///
+	/// The addCommand function takes the nodes from this pool.
+	/// The previously added dynamic commands are dropped.
+	/// @note There is a macro( attachNodePool ) to simplify this process.
+	/// @param pool Array of nodes. It has to be valid while the object is used.
+	/// @param size Number of nodes in the array.
+	void attachNodePoolFunction( commandNode_t *pool, uint32_t size );
+
+	/// Add a command at runtime.
+	///
+	/// The command is inserted to the dynamic command tree
+	/// in O( log n ) time, the init function does not have to
+	/// be called again. The element is not copied, so it has
+	/// to be valid until it is removed. The name of the command
+	/// has to be stored in RAM.
+	/// @param element Pointer to the API-tree element of the command.
+	/// @returns True if the command is added. It fails if the pool is empty or the name is already used.
+	bool addCommand( API_t *element );
+
+	/// Remove a command that was added at runtime.
+	///
+	/// The node of the command is returned to the pool in O( log n ) time.
+	/// @param name The name of the command.
+	/// @returns True if the command is found and removed.
+	bool removeCommand( const char *name );
+
 	/// Default execution function.
 	///
 	/// This function tries to execute a command.
@@ -202,6 +730,134 @@ public:
 	/// object.
 	void execute( const char *cmd, Stream *resp );
 
+	/// Execution function for length delimited commands.
+	///
+	/// The command does not have to be terminated, so a part of
+	/// a receive buffer can be executed without copying it. The
+	/// command is not modified, only the name and the arguments
+	/// are copied to the internal buffer of the command handler.
+	/// It has its own name, because execute( cmd, 0 ) would be
+	/// ambiguous with the Stream pointer of the other overloads.
+	/// It uses the default response channel.
+	/// @param cmd The first character of the command.
+	/// @param length Number of characters in the command.
+	void executeLength( const char *cmd, size_t length );
+
+	/// Execution function for length delimited commands.
+	///
+	/// The command does not have to be terminated, so a part of
+	/// a receive buffer can be executed without copying it. The
+	/// command is not modified, only the name and the arguments
+	/// are copied to the internal buffer of the command handler.
+	/// @param cmd The first character of the command.
+	/// @param length Number of characters in the command.
+	/// @param resp The messages from the command handler will be passed to this channel.
+	void executeLength( const char *cmd, size_t length, Stream *resp );
+
+	/// Prepare a command for repeated execution.
+	///
+	/// The command line is parsed and the commands of the pipeline are
+	/// searched, then the result is stored in the prepared structure.
+	/// The parameters in the arguments are written in braces, like
+	/// 'analogRead {pin}'. The slots are numbered by their first
+	/// appearance, and the same name is the same slot. The values of
+	/// the slots are empty, until they are set.
+	/// @param prepared The result is stored here.
+	/// @param cmd The command line.
+	/// @returns False, if a command is not found, the arguments do not fit,
+	///          or there are too many stages or slots. The internal commands
+	///          and the description printing can not be prepared. The control
+	///          characters 1 to 8 are used to store the slots, so a command
+	///          line with these characters is refused too.
+	bool prepare( preparedCommandCore_t *prepared, const char *cmd );
+
+	/// Set the value of a slot in a prepared command.
+	///
+	/// The string is not copied, it has to be valid while
+	/// the prepared command is executed.
+	/// @param prepared The prepared command.
+	/// @param slot Number of the slot, starting from 0.
+	/// @param value The new value of the slot.
+	/// @returns False, if the slot does not exist.
+	static bool setParameter( preparedCommandCore_t *prepared, uint8_t slot, const char *value );
+
+	/// Execute a prepared command.
+	///
+	/// It uses the default response channel.
+	/// @param prepared The prepared command.
+	/// @returns COMMAND_TOO_LONG, if the arguments with the parameter
+	///          values do not fit in the command buffer, COMMAND_OUTDATED,
+	///          if the command set changed since the command was prepared,
+	///          otherwise COMMAND_OK.
+	commandStatus_t executePrepared( preparedCommandCore_t *prepared );
+
+	/// Execute a prepared command.
+	/// @param prepared The prepared command.
+	/// @param resp The messages from the command handler will be passed to this channel.
+	/// @returns COMMAND_TOO_LONG, if the arguments with the parameter
+	///          values do not fit in the command buffer, COMMAND_OUTDATED,
+	///          if the command set changed since the command was prepared,
+	///          otherwise COMMAND_OK.
+	commandStatus_t executePrepared( preparedCommandCore_t *prepared, Stream *resp );
+
+	/// Execute more commands with one call.
+	///
+	/// The commands are separated by ';' or new line characters,
+	/// except inside quotes. The empty commands are skipped, the
+	/// spaces and the '\r' characters around the commands are removed.
+	/// @param script The commands in a terminated string.
+	/// @param resp The messages from the command handlers will be passed to this channel.
+	/// @param statuses The status of every executed command is stored in this array. It can be NULL.
+	/// @param statusSize Number of elements in the statuses array.
+	/// @param stopOnError If it is true, the execution stops at the first failed command.
+	/// @returns The number of executed commands, the failed one included.
+	uint32_t executeBatch( const char *script, Stream *resp, commandStatus_t *statuses = NULL, uint32_t statusSize = 0, bool stopOnError = true );
+
+	/// Execute more commands from a channel.
+	///
+	/// The format is the same as above. The batch ends with the end
+	/// of transmission character( 0x04, Ctrl-D in a terminal ), or if
+	/// no character arrives within the timeout of the channel, see
+	/// Stream::setTimeout. The last command is executed without a
+	/// separator too, so on a slow channel the gaps in the data have
+	/// to be shorter than the timeout. A command, that does not
+	/// fit in the command buffer is not executed, its status is
+	/// COMMAND_TOO_LONG. The incomplete line of the update
+	/// function is kept.
+	/// @param script The commands are read from this channel.
+	/// @param resp The messages from the command handlers will be passed to this channel.
+	/// @param statuses The status of every executed command is stored in this array. It can be NULL.
+	/// @param statusSize Number of elements in the statuses array.
+	/// @param stopOnError If it is true, the execution stops at the first failed command.
+	/// @returns The number of executed commands, the failed one included.
+	uint32_t executeBatch( Stream *script, Stream *resp, commandStatus_t *statuses = NULL, uint32_t statusSize = 0, bool stopOnError = true );
+
+	/// Read and execute the commands from a channel.
+	///
+	/// It is designed to be called from the loop function. The available
+	/// bytes are read in bulk to an internal line buffer and every complete
+	/// line is executed. The lines can be terminated with '\r', '\n' or
+	/// "\r\n", the empty lines are skipped. It never waits for the data,
+	/// the incomplete line is kept until the next call.
+	/// @param channel The commands are read from this channel and the
+	///                messages of the commands are passed to it.
+	/// @param byteBudget Maximum number of bytes read in one call. The
+	///                   rest of the data stays in the channel.
+	/// @param timeBudget If the execution takes longer than this many
+	///                   milliseconds, the remaining lines are executed
+	///                   in the next call. 0 means no time limit.
+	/// @returns The number of executed commands. It is always 0 without
+	///          a line buffer.
+	/// @note The line buffer is the lineBufferSize parameter of the
+	///       CommanderSized template, the CommanderLine class has one.
+	///       Use one object for every channel, because the object
+	///       stores the incomplete line.
+	uint32_t update( Stream *channel, uint32_t byteBudget = COMMANDER_UPDATE_BYTE_BUDGET, uint32_t timeBudget = 0 );
+
+	/// Set the handling of the too long lines in the update function.
+	/// @param policy The default is OVERFLOW_DISCARD.
+	void setOverflowPolicy( overflowPolicy_t policy );
+
 	/// Debug channel for Serial.
 	///
 	/// This function attaches a Serial channel
@@ -219,73 +875,361 @@ public:
 	/// @param out The help information will be printed to this Stream.
 	void printHelp( Stream* out );
 
+	#ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+	/// Attach a buffer for the help output.
+	///
+	/// The help text is assembled in this buffer and it is written
+	/// to the output channel in big chunks instead of many small
+	/// print calls. If the cache is enabled and the whole list of
+	/// the commands fits in the buffer, it is kept for the next
+	/// help command with the same options, so it is not generated
+	/// again. The cache is dropped when the commands are changed.
+	/// @param buffer The buffer for the help text.
+	/// @param size The size of the buffer in bytes.
+	/// @param cache If it is true, the last help text is cached.
+	void attachHelpBuffer( char *buffer, uint32_t size, bool cache = false );
+
+	#endif
+
+	#if ( COMMANDER_LOOKUP_CACHE_SIZE > 0 )
+
+	/// Number of the command searches, that are answered by the lookup cache.
+	uint32_t cacheHitCounter = 0;
+
+	/// Number of the command searches, that are not found in the lookup cache.
+	uint32_t cacheMissCounter = 0;
+
+	#endif
+
+	#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+	/// Enable the frequency weighted search tree.
+	///
+	/// It allocates a counter and two children for every entry
+	/// of the search index. From now on every found command is
+	/// counted. The search still uses the binary search until
+	/// rebuildWeightedSearch is called. It has to be called after
+	/// the init function, and again if a new index is attached.
+	/// It is not available with a shared index, because the tree
+	/// is rebuilt in place.
+	/// @returns True if the memory is allocated. The index can have at most 65534 entries.
+	///          It is false with a shared index.
+	bool enableWeightedSearch();
+
+	/// Disable the frequency weighted search tree and release its memory.
+	void disableWeightedSearch();
+
+	/// Rebuild the weighted search tree from the counters.
+	///
+	/// The tree is built with Mehlhorn's rule: every subtree root
+	/// splits the weight of its subtree as equally as possible, so
+	/// the frequently used commands are close to the root. It runs
+	/// in O( n log n ) time. It uses the memory of enableWeightedSearch,
+	/// so the automatic rebuild does not allocate in the search.
+	/// @returns True if the tree is rebuilt.
+	bool rebuildWeightedSearch();
+
+	/// Load a weight profile and rebuild the weighted search tree.
+	///
+	/// The names that are not found in the search index are skipped.
+	/// @param weights Array of the weights. It can be created with the apiWeight macro.
+	/// @param size Number of elements in the array.
+	/// @returns True if the tree is rebuilt.
+	bool importWeights( const commandWeight_t *weights, uint32_t size );
+
+	/// Print the counters as a weight profile.
+	///
+	/// Every used command is printed as an apiWeight line,
+	/// so the output can be pasted to the source code.
+	/// @param out The profile will be printed to this Stream.
+	void exportWeights( Stream *out );
+
+	#endif
+
+	#ifdef COMMANDER_ENABLE_STATISTICS
+
+	/// Number of the command searches.
+	uint32_t lookupCounter = 0;
+
+	/// Number of the word and character comparisons during the searches.
+	uint32_t compareCounter = 0;
+
+	#endif
+
+	/// Prints out the help string to the specified Stream.
+	/// @param out The help information will be printed to this Stream.
+	/// @param prefix Only the commands that start with this prefix will be printed.
+	/// @param page Only this page will be printed. The first page is 1, 0 means all pages.
+	void printHelp( Stream* out, const char *prefix, uint32_t page = 0 );
+
+protected:
+
+	/// Constructor. The buffers are provided by the CommanderSized template.
+	/// @param commandBuffer_p The command is copied to this buffer before the execution.
+	/// @param commandSize_p Size of the command buffer in bytes.
+	/// @param argumentBuffer_p The output of a pipeline stage is passed to the next one in this buffer.
+	/// @param argumentSize_p Size of the argument buffer in bytes.
+	/// @param pipeBuffer_p Buffer of the pipe channel.
+	/// @param pipeSize_p Size of the pipe buffer in bytes.
+	/// @param line_p State of the line assembler. It is NULL without a line buffer.
+	/// @param lineBuffer_p The update function collects the incoming line in this buffer.
+	/// @param lineSize_p Size of the line buffer in bytes.
+	CommanderCore( char *commandBuffer_p, uint32_t commandSize_p, char *argumentBuffer_p, uint32_t argumentSize_p, uint8_t *pipeBuffer_p, uint32_t pipeSize_p, lineState_t *line_p, char *lineBuffer_p, uint32_t lineSize_p );
+
 private:
 
-	/// Starting address of the API-tree.
-	API_t *API_tree = NULL;
+	/// The attached API-trees.
+	commandTree_t trees[ COMMANDER_MAX_ATTACHED_TREES ];
+
+	/// Number of the attached API-trees.
+	uint32_t treeCount = 0;
+
+	/// The search index used by the object.
+	#ifdef COMMANDER_CASE_INSENSITIVE
+	commandIndex_t index = { NULL, NULL, NULL, NULL, NULL, NULL, 0, MEMORY_REGULAR, NULL, NULL };
+	#else
+	commandIndex_t index = { NULL, NULL, NULL, NULL, NULL, NULL, 0, MEMORY_REGULAR, NULL };
+	#endif
+
+	/// This flag is set when the index is created by the init
+	/// function, so it has to be released by this object.
+	bool indexOwned = false;
+
+	/// Starting address of the alias array.
+	const commandAlias_t *aliasTable = NULL;
+
+	/// Number of elements in the alias array.
+	uint32_t aliasTableSize = 0;
+
+	#ifdef COMMANDER_ENABLE_HELP_BUFFER
+
+	/// Buffer for the help output. If it is NULL, the help
+	/// text is printed directly to the output channel.
+	char *helpBuffer = NULL;
+
+	/// The size of the help buffer in bytes.
+	uint32_t helpBufferSize = 0;
+
+	/// Flag to enable the help cache.
+	bool helpCacheEnabled = false;
+
+	/// This flag is set when the help buffer holds a complete help text.
+	bool helpCacheValid = false;
+
+	/// Options of the cached help text.
+	bool helpCacheDescription = false;
+	bool helpCacheStyle = false;
+
+	/// Length of the cached help text in bytes.
+	uint32_t helpCacheLength = 0;
+
+	#endif
+
+	#if ( COMMANDER_LOOKUP_CACHE_SIZE > 0 )
+
+	/// Entry of the lookup cache.
+	typedef struct lookupCacheEntry_t{
+
+		uint32_t hash;								// Hash of the name
+		uint8_t length;								// Length of the name, see commander_name_length
+		const char *name;							// Name of the command in the search structure. NULL means empty entry
+		API_t *element;								// The command
+		commandFunction_t func;				// Function of the command
+		memoryType_t memory;					// Memory type of the command
+		int32_t place;								// Alphabetical place of the command in the index. -1 for dynamic commands
+
+	}lookupCacheEntry_t;
+
+	/// Direct mapped lookup cache.
+	///
+	/// The entry of a name is selected by its hash. It stores
+	/// the last command that has been found with that hash.
+	lookupCacheEntry_t lookupCache[ COMMANDER_LOOKUP_CACHE_SIZE ] = {};
+
+	#endif
+
+	#ifdef COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+	/// Usage counters of the index entries.
+	uint32_t *weightCounts = NULL;
+
+	/// Prefix sums of the weights, used by the rebuild.
+	uint32_t *weightSums = NULL;
+
+	/// Left and right children of the weighted search tree.
+	uint16_t *weightLeft = NULL;
+	uint16_t *weightRight = NULL;
+
+	/// Root of the weighted search tree. If it is COMMANDER_WEIGHT_NONE,
+	/// the binary search is used.
+	uint16_t weightRoot = COMMANDER_WEIGHT_NONE;
 
-	/// Number of elements in the API-tree.
-	uint32_t API_tree_size = 0;
+	/// Number of the counted searches since the last rebuild.
+	uint32_t weightLookups = 0;
 
-	/// Internal variable for counting purpose.
-	uint32_t elementCounter;
+	/// Memory area of the counters, the prefix sums and the children.
+	void *weightMemory = NULL;
+
+	/// Build a subtree of the weighted search tree.
+	/// @param low The first place of the subtree.
+	/// @param high The place after the last place of the subtree.
+	/// @param sums Prefix sums of the weights.
+	/// @returns The root of the subtree or COMMANDER_WEIGHT_NONE if it is empty.
+	uint16_t weighted_build( uint32_t low, uint32_t high, const uint32_t *sums );
+
+	/// Search a command in the weighted search tree.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @param prefix The prefix word of the name.
+	/// @param fingerprint The fingerprint of the name.
+	/// @returns The alphabetical place of the command or -1 if it is not found.
+	int32_t weighted_search( const char *name, uint32_t length, commanderWord_t prefix, uint8_t fingerprint );
+
+	/// Count a use of a command.
+	/// @param place The alphabetical place of the command.
+	void weighted_count( uint32_t place );
+
+	#endif
+
+	#ifdef COMMANDER_ENABLE_SHARED_INDEX
+
+	/// The attached shared index. If it is NULL, the own index is used.
+	sharedIndex_t *sharedIndex = NULL;
+
+	/// The version of the shared index, that is copied to the index variable.
+	uint32_t sharedVersionSeen = 0;
+
+	/// Wait until the readers of the older versions are finished.
+	///
+	/// The epoch is flipped twice, and both reader counters are
+	/// drained after their flip, like in sleepable RCU.
+	/// @param shared The publication point of the index.
+	static void shared_synchronize( sharedIndex_t *shared );
+
+	#endif
+
+	/// Enter a read section of the shared index.
+	///
+	/// If a new version is published, it is attached to the object.
+	/// The version can not be released until the section is exited.
+	/// The sections can be nested. Without a shared index it does nothing.
+	/// @returns The reader counter, that has to be passed to shared_unlock.
+	uint8_t shared_lock();
+
+	/// Exit a read section of the shared index.
+	/// @param slot The reader counter returned by shared_lock.
+	void shared_unlock( uint8_t slot );
+
+	/// Attach a search index without detaching the shared index.
+	/// @param index_p The index.
+	void attach_index( const commandIndex_t *index_p );
+
+	/// Implementation of findIndexPrefix, without the read section.
+	uint32_t find_prefix( const char *prefix, uint32_t *first );
+
+	/// Implementation of autoComplete, without the read section.
+	uint32_t auto_complete( const char *prefix, char *buffer, uint32_t bufferSize );
+
+	/// Root of the dynamic command tree.
+	commandNode_t *dynamicRoot = NULL;
+
+	/// First free node in the node pool.
+	commandNode_t *dynamicFree = NULL;
+
+	#ifdef COMMANDER_ENABLE_HASH_TABLE
+
+	/// Displacement values of the attached hash table.
+	/// If it is NULL, the binary tree is used for search.
+	const uint16_t *hashSeeds = NULL;
+
+	/// Number of buckets in the attached hash table.
+	uint32_t hashBucketCount = 0;
+
+	/// Slots of the attached hash table.
+	const uint16_t *hashSlots = NULL;
+
+	/// Search a command in the attached hash table.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @returns The alphabetical place of the command or -1 if it is not found.
+	int32_t hashSearch( const char *name, uint32_t length );
+
+	#endif
 
 	/// Internal command buffer. The command data
 	/// has to be copied to this buffer. It is necessary
 	/// because the execute function has to modify the
 	/// content of the command.
-	char tempBuff[ COMMANDER_MAX_COMMAND_SIZE ];
+	char *tempBuff;
 
-	#ifdef __AVR__
+	/// Size of the command buffer in bytes.
+	uint32_t commandSize;
 
-	/// With the PROGMEM implementation we need to copy the
-	/// data from the PROGMEM area to a buffer for compersation.
-	char progmemBuffer[ COMMANDER_MAX_COMMAND_SIZE ];
+	/// State of the line assembler of the update function.
+	/// It is NULL, if the object has no line buffer.
+	lineState_t *line;
 
-	/// Compare two API-tree element's name.
-	///
-	/// It compares two API-tree element's name like a regular strcmp.
-	/// It compares the names stored in the name_P
-	/// variable. This names are stored in PROGMEM space.
-	/// @param element1 Pointer to an API-tree element.
-	/// @param element2 Pointer to an API-tree element.
-	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strcmp/) between the strings.
-	int commander_strcmp_progmem( API_t* element1, API_t* element2 );
+	#ifdef __AVR__
 
-	/// Compare an API-tree element's name with a regular string.
+	/// Compare a command name from the search index with a regular string.
 	///
-	/// It compares an API-tree element's name with a regular string like a regular strcmp.
-	/// @param element1 Pointer to an API-tree element.
+	/// It compares a name stored in PROGMEM with a regular string like a regular strcmp.
+	/// @param element1 Name of the command from the search index.
 	/// @param element2 Character array.
 	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strcmp/) between the strings.
-	int commander_strcmp_tree_ram_progmem( API_t* element1, char* element2 );
+	int commander_strcmp_tree_ram_progmem( const char* element1, const char* element2 );
 
 	#endif
 
-	/// Compare two API-tree element's name.
+	/// Compare a command name from the search index with a regular string.
 	///
-	/// It compares two API-tree element's name like a regular strcmp.
-	/// variable. This names are stored in PROGMEM space.
-	/// @param element1 Pointer to an API-tree element.
-	/// @param element2 Pointer to an API-tree element.
+	/// It compares a command name with a regular string like a regular strcmp.
+	/// @param element1 Name of the command from the search index.
+	/// @param element2 Character array.
 	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strcmp/) between the strings.
-	int commander_strcmp_regular( API_t* element1, API_t* element2 );
+	int commander_strcmp_tree_ram_regular( const char* element1, const char* element2 );
 
-	/// Compare an API-tree element's name with a regular string.
+	/// Compare a command name from the search index with a regular string.
 	///
-	/// It compares an API-tree element's name with a regular string like a regular strcmp.
-	/// @param element1 Pointer to an API-tree element.
+	/// It selects the regular or the PROGMEM version by the memory type.
+	/// A switch is used instead of a function pointer, so the objects
+	/// do not have to store it.
+	/// @param element1 Name of the command from the search index.
 	/// @param element2 Character array.
 	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strcmp/) between the strings.
-	int commander_strcmp_tree_ram_regular( API_t* element1, char* element2 );
+	int commander_strcmp_tree_ram( const char* element1, const char* element2 );
 
-	/// Function pointer to an internal strcmp like function.
-	/// It uses the regular version by default.
-	int( Commander::*commander_strcmp )( API_t* element1, API_t* element2 ) = &Commander::commander_strcmp_regular;
+	/// Compare the beginning of a command name from the search index with a regular string.
+	///
+	/// It works like a regular strncmp.
+	/// @param element1 Name of the command from the search index.
+	/// @param element2 Character array.
+	/// @param length Maximum number of characters to compare.
+	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strncmp/) between the strings.
+	int commander_strncmp_tree_ram_regular( const char* element1, const char* element2, size_t length );
 
-	/// Function pointer to an internal strcmp like function.
-	/// It uses the regular version by default.
-	int( Commander::*commander_strcmp_tree_ram )( API_t* element1, char* element2 ) = &Commander::commander_strcmp_tree_ram_regular;
+	#ifdef __AVR__
+
+	/// Compare the beginning of a command name from the search index with a regular string.
+	///
+	/// It works like a regular strncmp, but the name is stored in PROGMEM.
+	/// @param element1 Name of the command from the search index.
+	/// @param element2 Character array.
+	/// @param length Maximum number of characters to compare.
+	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strncmp/) between the strings.
+	int commander_strncmp_tree_ram_progmem( const char* element1, const char* element2, size_t length );
+
+	#endif
+
+	/// Compare the beginning of a command name from the search index with a regular string.
+	///
+	/// It selects the regular or the PROGMEM version by the memory type.
+	/// @param element1 Name of the command from the search index.
+	/// @param element2 Character array.
+	/// @param length Maximum number of characters to compare.
+	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strncmp/) between the strings.
+	int commander_strncmp_tree_ram( const char* element1, const char* element2, size_t length );
 
 	/// Default response handler class.
 	commandResponse defaultResponse;
@@ -304,29 +1248,240 @@ private:
 	/// points to the default debug response handler.
 	Stream *dbgResponse = &defaultDebugResponse;
 
-	/// Find an API element in the tree by alphabetical place.
-	uint16_t find_api_index_by_place( uint16_t place );
+	/// Sort the entries of an index to alphabetical order.
+	///
+	/// It uses heap sort, so it runs in O( n log n ) time
+	/// and it does not require any extra memory.
+	/// @param names Names of the entries.
+	/// @param elements Pointers to the API-tree elements of the entries.
+	/// @param size Number of entries.
+	/// @param type Memory type of the API-tree.
+	static void sort_index( const char **names, const API_t **elements, uint32_t size, memoryType_t type );
+
+	/// Merge the sorted segments of the index.
+	///
+	/// In every step the smallest name is selected from the heads
+	/// of the segments. The segments are few, so a linear search
+	/// is used instead of a heap. The duplicated names are dropped.
+	/// The output can be the same array as the input, if there is
+	/// only one segment.
+	/// @param names Names of the sorted segments.
+	/// @param elements Elements of the sorted segments.
+	/// @param bounds The i-th segment starts at bounds[ i ] and ends before bounds[ i + 1 ].
+	/// @param segments Number of segments.
+	/// @param outNames The merged names will be stored here.
+	/// @param outElements The merged elements will be stored here.
+	/// @param type Memory type of the names.
+	/// @param report The dropped names are printed here. It can be NULL.
+	/// @returns The number of merged entries.
+	static uint32_t merge_index( const char **names, const API_t **elements, const uint32_t *bounds, uint32_t segments, const char **outNames, const API_t **outElements, memoryType_t type, Print *report );
+
+	/// Restore the heap property for the sorting algorithm.
+	/// @param names Names of the entries.
+	/// @param elements Pointers to the API-tree elements of the entries.
+	/// @param root Index of the entry that has to be moved down in the heap.
+	/// @param size Number of entries in the heap.
+	/// @param type Memory type of the API-tree.
+	static void sift_down_index( const char **names, const API_t **elements, uint32_t root, uint32_t size, memoryType_t type );
+
+	/// Swap two entries of an index.
+	static void swap_index( const char **names, const API_t **elements, uint32_t a, uint32_t b );
+
+	/// Compare two command names.
+	///
+	/// It compares the names like a regular strcmp.
+	/// With PROGMEM memory type both names are stored in PROGMEM.
+	/// @param name1 Name of a command.
+	/// @param name2 Name of a command.
+	/// @param type Memory type of the API-tree.
+	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strcmp/) between the strings.
+	static int compare_names( const char *name1, const char *name2, memoryType_t type );
 
-	/// Swap two API elements in the tree.
-	void swap_api_elements( uint16_t index, uint16_t place );
+	#ifdef COMMANDER_CASE_INSENSITIVE
 
-	/// Optimizes the tree to make it balanced.
-	void optimize_api_tree();
+	/// Size of the lower case copy of a name.
+	/// @param name The name of the command.
+	/// @returns The size with the terminator character, or 0 if the name has no upper case characters.
+	static uint32_t key_size( const char *name );
 
-	/// Recursive function optimize a section in the tree.
+	#endif
+
+	/// Check if an entry of the index is an alias.
+	/// @param place The alphabetical place of the entry.
+	/// @returns True if the name of the entry is not the name of its element.
+	bool is_alias( uint32_t place );
+
+	/// Search a command in the index.
+	///
+	/// It uses a branchless binary search on the sorted names.
+	/// The prefix word and the fingerprint of the name are calculated
+	/// once, then most of the steps are decided by integer comparisons.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @returns The alphabetical place of the command or -1 if it is not found.
+	int32_t search_index( const char *name, uint32_t length );
+
+	/// Calculate the FNV-1a hash of a name.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @returns The 32-bit hash of the name.
+	static uint32_t name_hash( const char *name, uint32_t length );
+
+	/// Find a command by its name.
+	///
+	/// It checks the lookup cache first, then the search index
+	/// and the dynamic command tree.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @param func The function of the command will be stored here.
+	/// @param elementMemory The memory type of the command will be stored here.
+	/// @returns The command or NULL if it is not found.
+	API_t* find_command( const char *name, uint32_t length, commandFunction_t *func, memoryType_t *elementMemory );
+
+	/// It has to be called when the command set changes.
+	///
+	/// It drops the lookup cache and the help cache, because
+	/// they can hold removed or shadowed commands. The prepared
+	/// commands are invalidated by the version change.
+	void commands_changed();
+
+	/// Version of the command set. It changes with every
+	/// change of the command set.
+	uint32_t commandsVersion = 0;
+
+	/// Calculate the prefix word and the fingerprint of a name.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @param prefix The prefix word will be stored here.
+	/// @param fingerprint The fingerprint will be stored here.
+	static void name_key( const char *name, uint32_t length, commanderWord_t *prefix, uint8_t *fingerprint );
+
+	/// Compare a command from the index with a name.
+	///
+	/// The prefix words are compared first. If they are equal, the
+	/// rest of the names are compared by words.
+	/// @param place The alphabetical place of the command in the index.
+	/// @param name The name of the command.
+	/// @param length The length of the name in characters.
+	/// @param prefix The prefix word of the name.
+	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/strcmp/) between the strings.
+	int compare_index( uint32_t place, const char *name, uint32_t length, commanderWord_t prefix );
+
+	/// Compare two memory areas word by word.
+	///
+	/// The words are loaded with memcpy, so the areas does not
+	/// have to be aligned. If the platform supports unaligned
+	/// access, it compiles to simple load instructions.
+	/// @param str1 Pointer to the first memory area.
+	/// @param str2 Pointer to the second memory area.
+	/// @param size Number of bytes to compare.
+	/// @returns Returns an int value indicating the [relationship](https://cplusplus.com/reference/cstring/memcmp/) between the areas.
+	int commander_memcmp_words( const char *str1, const char *str2, uint32_t size );
+
+	/// Search a command in the dynamic command tree.
+	/// @param name The name of the command.
+	/// @returns The node of the command or NULL if it is not found.
+	commandNode_t* dynamic_search( const char *name );
+
+	/// Insert a node to a subtree of the dynamic command tree.
+	/// @param node Root of the subtree.
+	/// @param newNode The node that has to be inserted.
+	/// @returns The new root of the subtree.
+	commandNode_t* dynamic_insert( commandNode_t *node, commandNode_t *newNode );
+
+	/// Remove a command from a subtree of the dynamic command tree.
+	/// @param node Root of the subtree.
+	/// @param name The name of the command.
+	/// @param removed The removed node will be stored here.
+	/// @returns The new root of the subtree.
+	commandNode_t* dynamic_remove( commandNode_t *node, const char *name, commandNode_t **removed );
+
+	/// Remove the smallest node from a subtree of the dynamic command tree.
+	/// @param node Root of the subtree.
+	/// @param min The removed node will be stored here.
+	/// @returns The new root of the subtree.
+	commandNode_t* dynamic_remove_min( commandNode_t *node, commandNode_t **min );
+
+	/// Restore the AVL property of a node after insertion or removal.
+	/// @param node The node that has to be balanced.
+	/// @returns The new root of the subtree.
+	commandNode_t* dynamic_balance( commandNode_t *node );
+
+	/// Rotate a subtree to the left.
+	/// @param node Root of the subtree.
+	/// @returns The new root of the subtree.
+	commandNode_t* dynamic_rotate_left( commandNode_t *node );
+
+	/// Rotate a subtree to the right.
+	/// @param node Root of the subtree.
+	/// @returns The new root of the subtree.
+	commandNode_t* dynamic_rotate_right( commandNode_t *node );
+
+	/// Height of a subtree. It is 0 for an empty subtree.
+	uint8_t dynamic_height( commandNode_t *node );
+
+	/// Recalculate the height of a node from its children.
+	void dynamic_update( commandNode_t *node );
+
+	/// Start an in-order traversal of the dynamic command tree.
 	///
-	/// It is used by optimize_api_tree function. The elementCounter
-	/// has to be 0 before using this function. This function just
-	/// creates an order for the balanced tree, but does not create
-	/// the links between the elements.
-	void recursive_optimizer( int32_t start_index, int32_t stop_index );
+	/// The path to the first command that is not smaller than
+	/// the prefix is pushed to the stack.
+	/// @param prefix The traversal starts from this name.
+	/// @param stack Stack of the traversal with COMMANDER_DYNAMIC_MAX_HEIGHT elements.
+	/// @param depth Number of elements in the stack.
+	void dynamic_seek( const char *prefix, commandNode_t **stack, uint8_t *depth );
+
+	/// Step the in-order traversal of the dynamic command tree.
+	/// @param stack Stack of the traversal.
+	/// @param depth Number of elements in the stack.
+	/// @returns The next node in alphabetical order or NULL at the end.
+	commandNode_t* dynamic_next( commandNode_t **stack, uint8_t *depth );
 
 	/// Command execution.
 	///
 	/// This function executes a command. Before calling this
 	/// function, the response pointer and it's channel has to
-	/// be configured correctly.
-	void executeCommand( char *cmd );
+	/// be configured correctly. The command is parsed in place,
+	/// it is not modified and it does not have to be terminated.
+	/// @param cmd The first character of the command.
+	/// @param length Number of characters in the command.
+	/// @returns The status of the first failed command in
+	///          the pipeline, or COMMAND_OK.
+	commandStatus_t executeCommand( const char *cmd, uint32_t length );
+
+	/// Group execution.
+	///
+	/// This function executes the subcommand of a group.
+	/// If there is no subcommand, it prints the commands of the group.
+	/// @param args The command line after the name of the group.
+	/// @param resp The response channel of the parent command.
+	void executeGroup( char *args, Stream *resp );
+
+	/// Call a command function.
+	///
+	/// If the previous stage of a pipeline has an output, it is
+	/// passed as the arguments, and if this stage is not the last
+	/// one, the output is written to the pipe channel.
+	/// @param func The function of the command.
+	/// @param arg The arguments of the command.
+	/// @param pipeOutput True, if it is not the last stage of a pipeline.
+	/// @returns False, if the output of the previous stage does not fit
+	///          in the argument buffer. The function is not called then.
+	bool dispatch( commandFunction_t func, char *arg, bool pipeOutput );
+
+	/// Prepare a command. The shared index has to be locked by the caller.
+	bool prepare_command( preparedCommandCore_t *prepared, const char *cmd );
+
+	/// Execute the stages of a prepared command.
+	commandStatus_t execute_prepared( preparedCommandCore_t *prepared );
+
+	/// Print the error message of the too long commands.
+	void print_too_long();
+
+	/// Execute one command of a batch and store its status.
+	/// @returns False, if the batch has to stop.
+	bool batch_command( const char *cmd, uint32_t length, commandStatus_t *statuses, uint32_t statusSize, uint32_t *count, bool stopOnError );
 
 	/// Help function
 	///
@@ -343,14 +1498,60 @@ private:
 	/// alphabetical order. If the description
 	/// argument is set to true, it also prints
 	/// the description data for all commands.
-	/// todo Finish description.
-	void helpFunction( bool description, Stream* out, bool style = false );
+	/// @param description If it is true, the descriptions will be printed as well.
+	/// @param out The help information will be printed to this Stream.
+	/// @param style If it is true, the output will be colored.
+	/// @param prefix Only the commands that start with this prefix will be printed. NULL means all commands.
+	/// @param page Only this page will be printed. The first page is 1, 0 means all pages.
+	void helpFunction( bool description, Stream* out, bool style = false, const char *prefix = NULL, uint32_t page = 0 );
 
-	/// Search for a character in a string.
-	/// @param str Pointer to a character array where the search will be.
-	/// @param c This character will be searched in the string.
-	/// @returns If the character found in the string, the poisition of the first occurance will be returned.
-	int32_t hasChar( char* str, char c );
+	/// Generate the help text.
+	///
+	/// It walks the search index and the dynamic command tree
+	/// together in alphabetical order, so it runs in O( n ) time.
+	/// @param description If it is true, the descriptions will be printed as well.
+	/// @param out The help text will be printed to this channel.
+	/// @param style If it is true, the output will be colored.
+	/// @param prefix Only the commands that start with this prefix will be printed. NULL means all commands.
+	/// @param page Only this page will be printed. The first page is 1, 0 means all pages.
+	void help_render( bool description, Print* out, bool style, const char *prefix, uint32_t page );
+
+	/// Print one command for the help function.
+	/// @param element The command that has to be printed.
+	/// @param elementMemory Memory type of the command.
+	/// @param description If it is true, the description will be printed as well.
+	/// @param out The help information will be printed to this channel.
+	/// @param style If it is true, the output will be colored.
+	void helpElement( API_t *element, memoryType_t elementMemory, bool description, Print* out, bool style );
+
+	#ifndef COMMANDER_LEAN
+
+	/// Print the description of a command.
+	///
+	/// If the descriptions are compressed, the dictionary tokens are
+	/// expanded and the text is written in small chunks to the channel.
+	/// @param element The command, which description has to be printed.
+	/// @param elementMemory Memory type of the command.
+	/// @param out The description will be printed to this channel.
+	static void print_description( API_t *element, memoryType_t elementMemory, Print* out );
+
+	#endif
+
+	/// Print one alias for the help function.
+	///
+	/// The aliases are printed in one line with the name of the command.
+	/// @param place The alphabetical place of the alias in the index.
+	/// @param description If it is true, the layout of the description listing is used.
+	/// @param out The help information will be printed to this channel.
+	/// @param style If it is true, the output will be colored.
+	void helpAlias( uint32_t place, bool description, Print* out, bool style );
+
+	/// Help command handler.
+	///
+	/// It parses the arguments of the help command.
+	/// Usage: help [ -d ] [ prefix* ] [ -p page ]
+	/// @param args Pointer to the argument string.
+	void helpCommand( char *args );
 
 	#ifdef COMMANDER_ENABLE_PIPE_MODULE
 
@@ -359,12 +1560,110 @@ private:
 
 	/// If piping happenes the output of the first command will be copied to this buffer.
 	/// This way it can be passed to the second command and so on.
-	char pipeArgBuffer[ COMMANDER_MAX_COMMAND_SIZE ];
+	char *pipeArgBuffer;
+
+	/// Size of the argument buffer in bytes.
+	uint32_t argumentSize;
 
 	#endif
 
 };
 
+/// Line buffer of the update function.
+///
+/// It is a member of the CommanderSized objects. Without
+/// a line buffer it is empty, so it costs no memory.
+/// @tparam lineBufferSize Size of the line buffer in bytes.
+template< uint32_t lineBufferSize >
+struct commanderLineStorage_t{
+
+	CommanderCore::lineState_t state;
+	char buffer[ lineBufferSize ];
+
+	CommanderCore::lineState_t* statePointer(){ return &state; }
+	char* bufferPointer(){ return buffer; }
+
+};
+
+/// Empty line storage for the objects without a line buffer.
+template<>
+struct commanderLineStorage_t< 0 >{
+
+	CommanderCore::lineState_t* statePointer(){ return NULL; }
+	char* bufferPointer(){ return NULL; }
+
+};
+
+/// Commander class with its own buffers.
+///
+/// The sizes are compile time parameters, so the objects
+/// in the same firmware can accept different command lengths.
+/// For example CommanderSized< 256 > accepts 255 characters
+/// long commands. A longer command is not executed, it is
+/// reported as an error.
+/// @tparam commandBufferSize Size of the command buffer in bytes.
+/// @tparam argumentBufferSize Size of the buffer, that passes the output of
+///                        a pipeline stage as the arguments of the next one.
+/// @tparam pipeBufferSize Size of the pipe channel buffer in bytes.
+/// @tparam lineBufferSize Size of the line buffer of the update function
+///                        in bytes. 0 means that the object can not use
+///                        the update function, so it costs no memory.
+template< uint32_t commandBufferSize, uint32_t argumentBufferSize = commandBufferSize, uint32_t pipeBufferSize = commandBufferSize, uint32_t lineBufferSize = 0 >
+class CommanderSized : public CommanderCore{
+
+	static_assert( commandBufferSize >= 2, "The command buffer needs space for a character and the terminator!" );
+	static_assert( ( lineBufferSize == 0 ) || ( lineBufferSize >= 2 ), "The line buffer needs space for a character and the line ending!" );
+
+public:
+
+	/// Prepared command type of this object. Its argument
+	/// buffer has the same size as the command buffer.
+	typedef preparedCommandSized_t< commandBufferSize > preparedCommand_t;
+
+	#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+	CommanderSized() : CommanderCore( commandBuffer, commandBufferSize, argumentBuffer, argumentBufferSize, pipeBuffer, pipeBufferSize, lineStorage.statePointer(), lineStorage.bufferPointer(), lineBufferSize ){}
+
+	#else
+
+	CommanderSized() : CommanderCore( commandBuffer, commandBufferSize, NULL, 0, NULL, 0, lineStorage.statePointer(), lineStorage.bufferPointer(), lineBufferSize ){}
+
+	#endif
+
+private:
+
+	/// The command is copied to this buffer before the execution.
+	char commandBuffer[ commandBufferSize ];
+
+	/// The update function collects the incoming line in this buffer.
+	commanderLineStorage_t< lineBufferSize > lineStorage;
+
+	#ifdef COMMANDER_ENABLE_PIPE_MODULE
+
+	static_assert( argumentBufferSize >= 2, "The argument buffer needs space for a character and the terminator!" );
+	static_assert( pipeBufferSize >= 2, "The pipe buffer needs space for at least one character!" );
+
+	/// The output of a pipeline stage is collected in this buffer.
+	char argumentBuffer[ argumentBufferSize ];
+
+	/// Buffer of the pipe channel.
+	uint8_t pipeBuffer[ pipeBufferSize ];
+
+	#endif
+
+};
+
+/// Commander class with the default buffer sizes( COMMANDER_MAX_COMMAND_SIZE ).
+///
+/// It is a class and not a typedef, so it can be forward declared
+/// with 'class Commander;' like in the earlier versions.
+class Commander : public CommanderSized< COMMANDER_MAX_COMMAND_SIZE >{};
+
+/// Commander class with the default buffer sizes and a line buffer.
+///
+/// It can read the commands from a channel with the update function.
+class CommanderLine : public CommanderSized< COMMANDER_MAX_COMMAND_SIZE, COMMANDER_MAX_COMMAND_SIZE, COMMANDER_MAX_COMMAND_SIZE, COMMANDER_MAX_COMMAND_SIZE >{};
+
 
 
 #endif /* COMMANDER_API_SRC_COMMANDER_HPP_ */
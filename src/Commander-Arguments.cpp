@@ -0,0 +1,183 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include "Commander-Arguments.hpp"
+#include "Commander-Number.hpp"
+
+commanderArgs::commanderArgs( char *args ){
+
+	// The next character to process.
+	char *read = args;
+
+	// The next character of the actual argument. The quotes and
+	// the escape characters are removed, so it can be behind read.
+	char *write;
+
+	while( true ){
+
+		// Skip the separator characters.
+		while( ( *read == ' ' ) || ( *read == '\t' ) ){
+
+			read++;
+
+		}
+
+		if( *read == '\0' ){
+
+			return;
+
+		}
+
+		if( argc >= COMMANDER_MAX_ARGUMENTS ){
+
+			valid = false;
+			return;
+
+		}
+
+		if( *read == '\"' ){
+
+			read++;
+			argv[ argc ] = read;
+			write = read;
+
+			while( *read != '\"' ){
+
+				// The quote is not closed.
+				if( *read == '\0' ){
+
+					valid = false;
+					return;
+
+				}
+
+				if( ( *read == '\\' ) && ( ( read[ 1 ] == '\"' ) || ( read[ 1 ] == '\\' ) ) ){
+
+					read++;
+
+				}
+
+				*write = *read;
+				write++;
+				read++;
+
+			}
+
+			// Skip the closing quote. It has to be
+			// followed by a separator or the end.
+			read++;
+
+			if( ( *read != '\0' ) && ( *read != ' ' ) && ( *read != '\t' ) ){
+
+				valid = false;
+				return;
+
+			}
+
+			*write = '\0';
+
+		}
+
+		else{
+
+			argv[ argc ] = read;
+
+			while( ( *read != '\0' ) && ( *read != ' ' ) && ( *read != '\t' ) ){
+
+				read++;
+
+			}
+
+			if( *read != '\0' ){
+
+				*read = '\0';
+				read++;
+
+			}
+
+		}
+
+		argc++;
+
+	}
+
+}
+
+uint8_t commanderArgs::count(){
+
+	return argc;
+
+}
+
+bool commanderArgs::isValid(){
+
+	return valid;
+
+}
+
+bool commanderArgs::getInt( uint8_t i, int32_t *value ){
+
+	if( i >= argc ){
+
+		return false;
+
+	}
+
+	return commanderParseInt( argv[ i ], value );
+
+}
+
+bool commanderArgs::getFloat( uint8_t i, float *value ){
+
+	if( i >= argc ){
+
+		return false;
+
+	}
+
+	return commanderParseFloat( argv[ i ], value );
+
+}
+
+const char* commanderArgs::getString( uint8_t i ){
+
+	if( i >= argc ){
+
+		return NULL;
+
+	}
+
+	return argv[ i ];
+
+}
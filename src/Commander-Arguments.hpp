@@ -0,0 +1,119 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef COMMANDER_API_SRC_COMMANDER_ARGUMENTS_HPP_
+#define COMMANDER_API_SRC_COMMANDER_ARGUMENTS_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "Commander-Settings.hpp"
+
+/// Tokenized argument list for the command functions.
+///
+/// It splits the argument string of a command function to
+/// arguments only once, when it is created. The arguments are
+/// separated by spaces. An argument, that contains spaces can
+/// be quoted like "this one", and \" or \\ can be used inside
+/// the quotes. The string is tokenized in place, so no copy
+/// is made. The numbers are parsed only when they are requested.
+///
+/// Example:
+///
+///		void led_func( char *args, Stream *response ){
+///
+///			commanderArgs arguments( args );
+///			int32_t pin;
+///
+///			if( !arguments.getInt( 0, &pin ) ){
+///				response -> print( "Argument error!" );
+///				return;
+///			}
+///
+///		}
+class commanderArgs{
+
+public:
+
+	/// Constructor.
+	///
+	/// It tokenizes the argument string. The string is
+	/// modified, the terminator characters are placed after
+	/// the arguments and the quotes are removed.
+	/// @param args The argument string of the command function.
+	commanderArgs( char *args );
+
+	/// Number of arguments.
+	/// @returns The number of the successfully tokenized arguments.
+	uint8_t count();
+
+	/// Check the argument list.
+	/// @returns False, if a quote was not closed or there
+	///          were more than COMMANDER_MAX_ARGUMENTS arguments.
+	bool isValid();
+
+	/// Get an argument as an integer.
+	///
+	/// Decimal and hexadecimal( 0x prefix ) numbers are accepted.
+	/// @param i Index of the argument.
+	/// @param value The result is stored here.
+	/// @returns True, if the argument exists and it is a valid
+	///          number in the range of a 32-bit integer.
+	bool getInt( uint8_t i, int32_t *value );
+
+	/// Get an argument as a floating point number.
+	/// @param i Index of the argument.
+	/// @param value The result is stored here.
+	/// @returns True, if the argument exists and it is a valid number.
+	bool getFloat( uint8_t i, float *value );
+
+	/// Get an argument as a string.
+	/// @param i Index of the argument.
+	/// @returns Pointer to the terminated argument, or NULL if it does not exist.
+	const char* getString( uint8_t i );
+
+private:
+
+	/// The first character of every argument.
+	char *argv[ COMMANDER_MAX_ARGUMENTS ];
+
+	/// Number of the arguments.
+	uint8_t argc = 0;
+
+	/// It is false, if the tokenization failed.
+	bool valid = true;
+
+};
+
+#endif /* COMMANDER_API_SRC_COMMANDER_ARGUMENTS_HPP_ */
@@ -0,0 +1,247 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef COMMANDER_API_SRC_COMMANDER_BIND_HPP_
+#define COMMANDER_API_SRC_COMMANDER_BIND_HPP_
+
+#include "Commander-Arguments.hpp"
+
+#include "Stream.h"
+
+/// Typed command binding.
+///
+/// A regular C++ function can be used as a command with the apiBind macro.
+/// The types of the parameters and the return value are deduced at compile
+/// time, so a specialized parser is generated for every function. The
+/// arguments are checked before the function is called, and the return
+/// value is printed to the response channel.
+///
+/// Supported parameter types: integers, bool, float, double and strings.
+/// The integers are range checked, so 300 is rejected for an uint8_t.
+
+/// List of argument indexes, it is generated for the parameter list.
+template< uint8_t... I >
+struct commanderIndices{};
+
+/// Generates the 0, 1, ... N - 1 index list.
+template< uint8_t N, uint8_t... I >
+struct commanderMakeIndices : commanderMakeIndices< N - 1, N - 1, I... >{};
+
+template< uint8_t... I >
+struct commanderMakeIndices< 0, I... >{
+
+	typedef commanderIndices< I... > type;
+
+};
+
+/// Removes the const and reference qualifiers of a parameter type,
+/// the parsed value is stored in this type.
+template< typename T >
+struct commanderStorageType{ typedef T type; };
+
+template< typename T >
+struct commanderStorageType< const T >{ typedef T type; };
+
+template< typename T >
+struct commanderStorageType< T& >{ typedef typename commanderStorageType< T >::type type; };
+
+/// Storage for one parsed argument.
+template< uint8_t I, typename T >
+struct commanderArgumentSlot{
+
+	T value;
+
+};
+
+/// Storage for all of the parsed arguments.
+template< typename Indices, typename... T >
+struct commanderArgumentSlots;
+
+template< uint8_t... I, typename... T >
+struct commanderArgumentSlots< commanderIndices< I... >, T... > : commanderArgumentSlot< I, T >...{};
+
+/// Parse an integer argument with range check.
+template< typename T >
+bool commanderParseArgument( commanderArgs &arguments, uint8_t i, T *value ){
+
+	int32_t result;
+
+	if( !arguments.getInt( i, &result ) ){
+
+		return false;
+
+	}
+
+	// Negative number for an unsigned type.
+	if( ( (T)-1 > (T)0 ) && ( result < 0 ) ){
+
+		return false;
+
+	}
+
+	// The value is changed by the conversion, so it is out of range.
+	if( (int32_t)(T)result != result ){
+
+		return false;
+
+	}
+
+	*value = (T)result;
+	return true;
+
+}
+
+inline bool commanderParseArgument( commanderArgs &arguments, uint8_t i, float *value ){
+
+	return arguments.getFloat( i, value );
+
+}
+
+inline bool commanderParseArgument( commanderArgs &arguments, uint8_t i, double *value ){
+
+	float result;
+
+	if( !arguments.getFloat( i, &result ) ){
+
+		return false;
+
+	}
+
+	*value = result;
+	return true;
+
+}
+
+inline bool commanderParseArgument( commanderArgs &arguments, uint8_t i, const char **value ){
+
+	*value = arguments.getString( i );
+	return *value != NULL;
+
+}
+
+/// The arguments are tokenized in the modifiable argument
+/// string, so they can be passed as modifiable strings too.
+inline bool commanderParseArgument( commanderArgs &arguments, uint8_t i, char **value ){
+
+	*value = (char*)arguments.getString( i );
+	return *value != NULL;
+
+}
+
+/// Calls the function and prints the result.
+template< typename R >
+struct commanderBindCall{
+
+	template< typename F, typename... V >
+	static void call( F function, Stream *response, V&... values ){
+
+		response -> print( function( values... ) );
+
+	}
+
+};
+
+/// Functions without return value print nothing.
+template<>
+struct commanderBindCall< void >{
+
+	template< typename F, typename... V >
+	static void call( F function, Stream *response, V&... values ){
+
+		( void )response;
+		function( values... );
+
+	}
+
+};
+
+/// Command function generator.
+///
+/// The handler function of this class is used as the command function.
+/// @note Use the apiBind macro, it fills the template parameters.
+template< typename F, F function >
+struct commanderBinding;
+
+template< typename R, typename... A, R( *function )( A... ) >
+struct commanderBinding< R( * )( A... ), function >{
+
+	/// Command function for the API-tree.
+	static void handler( char *args, Stream *response ){
+
+		commanderArgs arguments( args );
+
+		if( !arguments.isValid() || ( arguments.count() != sizeof...( A ) ) || !parse_and_call( arguments, response, typename commanderMakeIndices< sizeof...( A ) >::type() ) ){
+
+			#ifdef __AVR__
+			response -> print( F( "Argument error!" ) );
+			#else
+			response -> print( (const char*)"Argument error!" );
+			#endif
+
+		}
+
+	}
+
+private:
+
+	/// Parse every argument, then call the function if all of them are valid.
+	template< uint8_t... I >
+	static bool parse_and_call( commanderArgs &arguments, Stream *response, commanderIndices< I... > ){
+
+		commanderArgumentSlots< commanderIndices< I... >, typename commanderStorageType< A >::type... > slots;
+
+		bool valid = true;
+
+		// Functions without parameters do not use the slots.
+		( void )slots;
+
+		// The arguments are parsed from left to right, and the
+		// parsing stops at the first invalid one.
+		bool results[] = { true, ( valid = valid && commanderParseArgument( arguments, I, &static_cast< commanderArgumentSlot< I, typename commanderStorageType< A >::type >& >( slots ).value ) )... };
+		( void )results;
+
+		if( !valid ){
+
+			return false;
+
+		}
+
+		commanderBindCall< R >::call( function, response, static_cast< commanderArgumentSlot< I, typename commanderStorageType< A >::type >& >( slots ).value... );
+		return true;
+
+	}
+
+};
+
+#endif /* COMMANDER_API_SRC_COMMANDER_BIND_HPP_ */
@@ -0,0 +1,129 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef COMMANDER_API_SRC_COMMANDER_DICTIONARY_HPP_
+#define COMMANDER_API_SRC_COMMANDER_DICTIONARY_HPP_
+
+#include "Commander-Settings.hpp"
+
+/// Shared dictionary of the description texts.
+///
+/// The descriptions of the commands have a lot of common phrases.
+/// If COMMANDER_COMPRESSED_DESCRIPTIONS is defined, every phrase
+/// is stored only once in the dictionary, and the descriptions store
+/// a one byte token instead of it. The token of the n-th phrase
+/// is 0x80 + n, so the regular ASCII characters are not affected.
+/// The tokens are expanded, when the description is printed.
+///
+/// To use a phrase in a description, concatenate its macro
+/// with the other parts of the text:
+///
+///		apiElement( "led", "Set the LED." COMMANDER_DICT_EXAMPLE "led 1", led_func )
+///
+/// @note The order of the phrases has to be the same in the
+///       COMMANDER_DICTIONARY_TEXT list and in the token macros.
+
+#define COMMANDER_DICT_TEXT_EXAMPLE			"\r\n\tExample: "
+#define COMMANDER_DICT_TEXT_PIN_NUMBER		" [ Pin Number ]"
+#define COMMANDER_DICT_TEXT_PIN_NUMBER_HELP	"\r\n\t[ Pin Number ] - The number ofthe pin. Typically printed on the board."
+#define COMMANDER_DICT_TEXT_RETURNS_HELP	"\r\n\t[ Returns ] - "
+#define COMMANDER_DICT_TEXT_LOW_HIGH		"0 means low, 1 means high."
+#define COMMANDER_DICT_TEXT_RETURNS			"Returns the "
+#define COMMANDER_DICT_TEXT_SINCE_START		" passed since the program started."
+#define COMMANDER_DICT_TEXT_RADIANS			" function. The input is in radians."
+#define COMMANDER_DICT_TEXT_STATE			" the state of "
+#define COMMANDER_DICT_TEXT_INFORMATION		" information."
+#define COMMANDER_DICT_TEXT_OFFSET_SEC		" Offset Sec ]"
+#define COMMANDER_DICT_TEXT_NUMBER			" number"
+#define COMMANDER_DICT_TEXT_INTEGER_BOUND	" integer bound"
+
+/// All phrases in token order. Every phrase is terminated,
+/// so the n-th phrase starts after the n-th terminator.
+#define COMMANDER_DICTIONARY_TEXT \
+	COMMANDER_DICT_TEXT_EXAMPLE "\0" \
+	COMMANDER_DICT_TEXT_PIN_NUMBER "\0" \
+	COMMANDER_DICT_TEXT_PIN_NUMBER_HELP "\0" \
+	COMMANDER_DICT_TEXT_RETURNS_HELP "\0" \
+	COMMANDER_DICT_TEXT_LOW_HIGH "\0" \
+	COMMANDER_DICT_TEXT_RETURNS "\0" \
+	COMMANDER_DICT_TEXT_SINCE_START "\0" \
+	COMMANDER_DICT_TEXT_RADIANS "\0" \
+	COMMANDER_DICT_TEXT_STATE "\0" \
+	COMMANDER_DICT_TEXT_INFORMATION "\0" \
+	COMMANDER_DICT_TEXT_OFFSET_SEC "\0" \
+	COMMANDER_DICT_TEXT_NUMBER "\0" \
+	COMMANDER_DICT_TEXT_INTEGER_BOUND
+
+/// The first token byte.
+#define COMMANDER_DICT_TOKEN_FIRST 0x80
+
+/// Number of phrases in the dictionary. The other
+/// bytes above 0x7F are printed without change.
+#define COMMANDER_DICT_TOKEN_COUNT 13
+
+#ifdef COMMANDER_COMPRESSED_DESCRIPTIONS
+
+	#define COMMANDER_DICT_EXAMPLE			"\x80"
+	#define COMMANDER_DICT_PIN_NUMBER		"\x81"
+	#define COMMANDER_DICT_PIN_NUMBER_HELP	"\x82"
+	#define COMMANDER_DICT_RETURNS_HELP		"\x83"
+	#define COMMANDER_DICT_LOW_HIGH			"\x84"
+	#define COMMANDER_DICT_RETURNS			"\x85"
+	#define COMMANDER_DICT_SINCE_START		"\x86"
+	#define COMMANDER_DICT_RADIANS			"\x87"
+	#define COMMANDER_DICT_STATE			"\x88"
+	#define COMMANDER_DICT_INFORMATION		"\x89"
+	#define COMMANDER_DICT_OFFSET_SEC		"\x8A"
+	#define COMMANDER_DICT_NUMBER			"\x8B"
+	#define COMMANDER_DICT_INTEGER_BOUND	"\x8C"
+
+#else
+
+	#define COMMANDER_DICT_EXAMPLE			COMMANDER_DICT_TEXT_EXAMPLE
+	#define COMMANDER_DICT_PIN_NUMBER		COMMANDER_DICT_TEXT_PIN_NUMBER
+	#define COMMANDER_DICT_PIN_NUMBER_HELP	COMMANDER_DICT_TEXT_PIN_NUMBER_HELP
+	#define COMMANDER_DICT_RETURNS_HELP		COMMANDER_DICT_TEXT_RETURNS_HELP
+	#define COMMANDER_DICT_LOW_HIGH			COMMANDER_DICT_TEXT_LOW_HIGH
+	#define COMMANDER_DICT_RETURNS			COMMANDER_DICT_TEXT_RETURNS
+	#define COMMANDER_DICT_SINCE_START		COMMANDER_DICT_TEXT_SINCE_START
+	#define COMMANDER_DICT_RADIANS			COMMANDER_DICT_TEXT_RADIANS
+	#define COMMANDER_DICT_STATE			COMMANDER_DICT_TEXT_STATE
+	#define COMMANDER_DICT_INFORMATION		COMMANDER_DICT_TEXT_INFORMATION
+	#define COMMANDER_DICT_OFFSET_SEC		COMMANDER_DICT_TEXT_OFFSET_SEC
+	#define COMMANDER_DICT_NUMBER			COMMANDER_DICT_TEXT_NUMBER
+	#define COMMANDER_DICT_INTEGER_BOUND	COMMANDER_DICT_TEXT_INTEGER_BOUND
+
+#endif
+
+#endif /* COMMANDER_API_SRC_COMMANDER_DICTIONARY_HPP_ */
@@ -0,0 +1,388 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+
+#ifndef COMMANDER_API_SRC_COMMANDER_HASH_HPP_
+#define COMMANDER_API_SRC_COMMANDER_HASH_HPP_
+
+#include "Commander-API.hpp"
+
+#ifdef COMMANDER_ENABLE_HASH_TABLE
+
+/// This macro creates a compile time hash table from an API-tree.
+///
+/// The API-tree has to be a global constexpr array. The table is generated
+/// by the compiler, so Commander does not have to be initialized
+/// at runtime. Duplicate command names are rejected at compile time.
+/// @note To attach the table to the Commander object, use the attachHashTable function.
+#define apiHashTable( name, tree ) \
+	constexpr commanderHashTable< sizeof( tree ) / sizeof( tree[ 0 ] ) > name( tree ); \
+	static_assert( !name.duplicate, "Duplicate command name found in " #tree "!" ); \
+	static_assert( name.valid, "Hash table can not be generated for " #tree "!" )
+
+/// Calculates the hash of a command name.
+///
+/// It uses the FNV-1a algorithm. In case-insensitive mode the
+/// characters are folded to lower case.
+/// @param name The name of the command.
+/// @returns The 32-bit hash of the name.
+constexpr uint32_t commanderHashString( const char *name ){
+
+	uint32_t hash = 2166136261UL;
+
+	while( *name ){
+
+		hash ^= (uint8_t)commander_fold( *name );
+		hash *= 16777619UL;
+		name++;
+
+	}
+
+	return hash;
+
+}
+
+/// Mixes a command name hash with the displacement value of a bucket.
+/// @param hash The hash of the command name.
+/// @param seed Displacement value of the bucket.
+/// @returns The mixed value. It has to be divided by the table size to get the slot.
+constexpr uint32_t commanderHashMix( uint32_t hash, uint16_t seed ){
+
+	hash += (uint32_t)seed * 0x9E3779B9UL;
+	hash ^= hash >> 16;
+	hash *= 0x85EBCA6BUL;
+	hash ^= hash >> 13;
+	hash *= 0xC2B2AE35UL;
+	hash ^= hash >> 16;
+
+	return hash;
+
+}
+
+/// Compile time strlen.
+constexpr uint32_t commanderHashStrlen( const char *str ){
+
+	uint32_t length = 0;
+
+	while( str[ length ] ){
+
+		length++;
+
+	}
+
+	return length;
+
+}
+
+/// Compile time strcmp.
+///
+/// In case-insensitive mode the characters are folded to lower case.
+constexpr int commanderHashStrcmp( const char *str1, const char *str2 ){
+
+	while( *str1 && ( commander_fold( *str1 ) == commander_fold( *str2 ) ) ){
+
+		str1++;
+		str2++;
+
+	}
+
+	return (uint8_t)commander_fold( *str1 ) - (uint8_t)commander_fold( *str2 );
+
+}
+
+/// Compile time minimal perfect hash table.
+///
+/// It is generated from a constexpr API-tree with the hash and displace
+/// method. The commands are hashed into buckets, then for every bucket
+/// a displacement value is searched, that moves all the commands in it
+/// to a free slot. Every slot stores the alphabetical place of the command,
+/// so a lookup costs one hash calculation and one string comparison.
+/// The search index arrays are stored in alphabetical order, so the
+/// help function works the same way as with the runtime generated index.
+/// The elements are not copied, the table points to the API-tree.
+template< uint32_t N >
+class commanderHashTable{
+
+public:
+
+	static_assert( N > 0, "The API-tree can not be empty!" );
+	static_assert( N < 0xFFFF, "Too many commands for a hash table!" );
+
+	/// Number of buckets. Every bucket holds four commands in average.
+	static constexpr uint32_t bucketCount = ( N + 3 ) / 4;
+
+	/// Pointers to the API-tree elements in alphabetical order.
+	const Commander::API_t *elements[ N ];
+
+	/// Names of the elements in alphabetical order.
+	const char *names[ N ];
+
+	/// Length of the names in alphabetical order.
+	uint8_t lengths[ N ];
+
+	/// Function of the elements in alphabetical order.
+	Commander::commandFunction_t funcs[ N ];
+
+	/// Displacement value for every bucket.
+	uint16_t seeds[ bucketCount ];
+
+	/// Alphabetical place of the command for every slot.
+	uint16_t slots[ N ];
+
+	/// This flag is set when a command name is present more than once.
+	bool duplicate;
+
+	/// This flag is set when the table is generated successfully.
+	bool valid;
+
+	/// Generates the table from an API-tree.
+	/// @param tree Constexpr API-tree array.
+	constexpr commanderHashTable( const Commander::API_t ( &tree )[ N ] ) : elements(), names(), lengths(), funcs(), seeds(), slots(), duplicate( false ), valid( false ){
+
+		uint32_t i = 0;
+		uint32_t j = 0;
+		uint32_t k = 0;
+
+		uint16_t order[ N ] = {};
+		uint32_t hashes[ N ] = {};
+		uint16_t members[ N ] = {};
+		uint32_t bucketStart[ bucketCount + 1 ] = {};
+		bool used[ N ] = {};
+
+		for( i = 0; i < N; i++ ){
+
+			order[ i ] = i;
+
+		}
+
+		// Create alphabetical order.
+		sort( tree, order );
+
+		for( i = 0; i < N; i++ ){
+
+			elements[ i ] = &tree[ order[ i ] ];
+			names[ i ] = tree[ order[ i ] ].name;
+			lengths[ i ] = commander_name_length( commanderHashStrlen( names[ i ] ) );
+			funcs[ i ] = tree[ order[ i ] ].func;
+
+		}
+
+		// In alphabetical order the duplicates are next to each other.
+		for( i = 1; i < N; i++ ){
+
+			if( commanderHashStrcmp( names[ i - 1 ], names[ i ] ) == 0 ){
+
+				duplicate = true;
+				return;
+
+			}
+
+		}
+
+		for( i = 0; i < N; i++ ){
+
+			hashes[ i ] = commanderHashString( names[ i ] );
+			bucketStart[ hashes[ i ] % bucketCount + 1 ]++;
+
+		}
+
+		// Group the commands by buckets. After this step the members
+		// of the i-th bucket can be found between bucketStart[ i ]
+		// and bucketStart[ i + 1 ] in the members array.
+		for( i = 0; i < bucketCount; i++ ){
+
+			bucketStart[ i + 1 ] += bucketStart[ i ];
+
+		}
+
+		for( i = 0; i < N; i++ ){
+
+			j = hashes[ i ] % bucketCount;
+			k = bucketStart[ j ];
+
+			while( members[ k ] != 0 ){
+
+				k++;
+
+			}
+
+			// Zero marks the empty members, so the index is stored with an offset.
+			members[ k ] = i + 1;
+
+		}
+
+		// The biggest buckets are processed first, because
+		// they are harder to place when the table fills up.
+		for( k = N; k > 0; k-- ){
+
+			for( i = 0; i < bucketCount; i++ ){
+
+				if( ( bucketStart[ i + 1 ] - bucketStart[ i ] ) != k ){
+
+					continue;
+
+				}
+
+				if( !placeBucket( i, bucketStart[ i ], bucketStart[ i + 1 ], hashes, members, used ) ){
+
+					return;
+
+				}
+
+			}
+
+		}
+
+		valid = true;
+
+	}
+
+private:
+
+	/// Heap sort for the place order of the elements.
+	constexpr void sort( const Commander::API_t ( &tree )[ N ], uint16_t ( &order )[ N ] ){
+
+		uint32_t i = 0;
+		uint16_t temp = 0;
+
+		for( i = N / 2; i > 0; i-- ){
+
+			siftDown( tree, order, i - 1, N );
+
+		}
+
+		for( i = N; i > 1; i-- ){
+
+			temp = order[ 0 ];
+			order[ 0 ] = order[ i - 1 ];
+			order[ i - 1 ] = temp;
+
+			siftDown( tree, order, 0, i - 1 );
+
+		}
+
+	}
+
+	/// Restore the heap property for the sorting algorithm.
+	constexpr void siftDown( const Commander::API_t ( &tree )[ N ], uint16_t ( &order )[ N ], uint32_t root, uint32_t size ){
+
+		uint32_t child = 0;
+		uint16_t temp = 0;
+
+		while( ( 2 * root + 1 ) < size ){
+
+			child = 2 * root + 1;
+
+			if( ( ( child + 1 ) < size ) && ( commanderHashStrcmp( tree[ order[ child ] ].name, tree[ order[ child + 1 ] ].name ) < 0 ) ){
+
+				child++;
+
+			}
+
+			if( commanderHashStrcmp( tree[ order[ root ] ].name, tree[ order[ child ] ].name ) >= 0 ){
+
+				return;
+
+			}
+
+			temp = order[ root ];
+			order[ root ] = order[ child ];
+			order[ child ] = temp;
+
+			root = child;
+
+		}
+
+	}
+
+	/// Search a displacement value for a bucket.
+	/// @returns True, if every command in the bucket has been placed to a free slot.
+	constexpr bool placeBucket( uint32_t bucket, uint32_t start, uint32_t stop, const uint32_t ( &hashes )[ N ], const uint16_t ( &members )[ N ], bool ( &used )[ N ] ){
+
+		uint32_t seed = 0;
+		uint32_t i = 0;
+		uint32_t j = 0;
+		uint32_t slot = 0;
+
+		for( seed = 0; seed < 0xFFFF; seed++ ){
+
+			for( i = start; i < stop; i++ ){
+
+				slot = commanderHashMix( hashes[ members[ i ] - 1 ], seed ) % N;
+
+				// The slot is taken, or it collides with an other
+				// command from the same bucket.
+				if( used[ slot ] ){
+
+					break;
+
+				}
+
+				used[ slot ] = true;
+				slots[ slot ] = members[ i ] - 1;
+
+			}
+
+			if( i == stop ){
+
+				seeds[ bucket ] = seed;
+				return true;
+
+			}
+
+			// Release the slots that has been taken by this try.
+			for( j = start; j < i; j++ ){
+
+				used[ commanderHashMix( hashes[ members[ j ] - 1 ], seed ) % N ] = false;
+
+			}
+
+		}
+
+		return false;
+
+	}
+
+};
+
+template< uint32_t N >
+void CommanderCore::attachHashTable( const commanderHashTable< N > &table ){
+
+	attachHashTableFunction( table.elements, N, table.names, table.lengths, table.funcs, table.seeds, commanderHashTable< N >::bucketCount, table.slots );
+
+}
+
+#endif
+
+#endif /* COMMANDER_API_SRC_COMMANDER_HASH_HPP_ */
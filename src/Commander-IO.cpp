@@ -34,6 +34,14 @@ SOFTWARE.
 
 #include "Commander-IO.hpp"
 
+void commanderPipeChannel::begin( uint8_t *buffer_p, uint32_t size_p ){
+
+	buffer = buffer_p;
+	size = size_p;
+	clear();
+
+}
+
 int commanderPipeChannel::available(){
 
 	if( writePointer == readPointer ){
@@ -46,7 +54,7 @@ int commanderPipeChannel::available(){
 
 	else{
 
-		return COMMANDER_MAX_COMMAND_SIZE - readPointer + writePointer;
+		return size - readPointer + writePointer;
 
 	}
 
@@ -67,7 +75,7 @@ int commanderPipeChannel::read(){
 		ret = (uint8_t)buffer[ readPointer ];
 		readPointer++;
 
-		if( readPointer >= COMMANDER_MAX_COMMAND_SIZE ){
+		if( readPointer >= size ){
 			readPointer = 0;
 		}
 
@@ -101,30 +109,127 @@ int commanderPipeChannel::peek(){
 
 size_t commanderPipeChannel::write( uint8_t data ){
 
-  buffer[ writePointer ] = data;
-	writePointer++;
-	if( writePointer >= COMMANDER_MAX_COMMAND_SIZE ){
-		writePointer = 0;
+	uint32_t next;
+
+	next = writePointer + 1;
+	if( next >= size ){
+		next = 0;
 	}
 
+	// The buffer is full, the data would overwrite the unread bytes.
+	if( ( size == 0 ) || ( next == readPointer ) ){
+
+		overflow = true;
+		return 0;
+
+	}
+
+  buffer[ writePointer ] = data;
+	writePointer = next;
+
   return 1;
 
 }
 
-size_t commanderPipeChannel::write( const uint8_t *data, size_t size ){
+size_t commanderPipeChannel::write( const uint8_t *data, size_t size_p ){
 
   uint32_t i;
 
-	for( i = 0; i < size; i++ ){
+	for( i = 0; i < size_p; i++ ){
+
+		if( write( data[ i ] ) == 0 ){
+
+			break;
 
-		buffer[ writePointer ] = data[ i ];
-		writePointer++;
-		if( writePointer >= COMMANDER_MAX_COMMAND_SIZE ){
-			writePointer = 0;
 		}
 
 	}
 
-  return size;
+  return i;
+
+}
+
+void commanderPipeChannel::clear(){
+
+	readPointer = 0;
+	writePointer = 0;
+	overflow = false;
+
+}
+
+bool commanderPipeChannel::overflowed(){
+
+	return overflow;
+
+}
+
+void commanderBufferedChannel::begin( Print *out_p, uint8_t *buffer_p, uint32_t size_p ){
+
+	out = out_p;
+	buffer = buffer_p;
+	size = size_p;
+	writePointer = 0;
+	overflow = false;
+
+}
+
+size_t commanderBufferedChannel::write( uint8_t data ){
+
+	// Without buffer the data is passed through.
+	if( size == 0 ){
+
+		return out -> write( data );
+
+	}
+
+	if( writePointer >= size ){
+
+		flushBuffer();
+		overflow = true;
+
+	}
+
+	buffer[ writePointer ] = data;
+	writePointer++;
+
+	return 1;
+
+}
+
+size_t commanderBufferedChannel::write( const uint8_t *data, size_t size_p ){
+
+	uint32_t i;
+
+	for( i = 0; i < size_p; i++ ){
+
+		write( data[ i ] );
+
+	}
+
+	return size_p;
+
+}
+
+void commanderBufferedChannel::flushBuffer(){
+
+	if( writePointer > 0 ){
+
+		out -> write( buffer, writePointer );
+
+	}
+
+	writePointer = 0;
+
+}
+
+uint32_t commanderBufferedChannel::length(){
+
+	return writePointer;
+
+}
+
+bool commanderBufferedChannel::overflowed(){
+
+	return overflow;
 
 }
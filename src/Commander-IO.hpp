@@ -104,6 +104,13 @@ class commanderPipeChannel : public Stream{
 
 public:
 
+  /// Attach the buffer of the channel.
+  ///
+  /// The channel is emptied. It can store one byte less than the size of the buffer.
+  /// @param buffer_p The data is stored in this buffer.
+  /// @param size_p The size of the buffer in bytes.
+  void   begin( uint8_t *buffer_p, uint32_t size_p );
+
   /// Available bytes in the channel.
   ///
   /// @returns The available bytes in the channel.
@@ -125,17 +132,75 @@ public:
   /// Write one byte to the channel.
   ///
   /// @param b The value that has to be written to the channel.
-  /// @returns The number of bytes that has been sucessfully written to the channel. Because it is the base class, it returns 0.
+  /// @returns The number of bytes that has been sucessfully written to the channel. If the buffer is full, it returns 0.
 	size_t write( uint8_t b ) override;
 
 	size_t write( const uint8_t *buffer, size_t size ) override;
 
+  /// Remove the data from the channel and reset the overflow flag.
+  void   clear();
+
+  /// It is true, when some data did not fit in the
+  /// buffer since the channel was cleared.
+  bool   overflowed();
+
 private:
-	uint8_t buffer[ COMMANDER_MAX_COMMAND_SIZE ];
+	uint8_t *buffer = NULL;
+	uint32_t size = 0;
 	uint32_t readPointer = 0;
 	uint32_t writePointer = 0;
+	bool overflow = false;
 
 };
 
+/// Buffered output channel.
+///
+/// It collects the printed data in a buffer and writes it to
+/// the output channel in big chunks. With network channels every
+/// write call can be a separate packet, so it is much faster than
+/// printing the data character by character.
+class commanderBufferedChannel : public Print{
+
+public:
+
+  /// Start a new output.
+  ///
+  /// @param out_p The data will be written to this channel.
+  /// @param buffer_p The data is collected in this buffer.
+  /// @param size_p The size of the buffer in bytes.
+  void   begin( Print *out_p, uint8_t *buffer_p, uint32_t size_p );
+
+  /// Write one byte to the buffer.
+  ///
+  /// If the buffer is full, it is written to the output channel first.
+  /// @param b The value that has to be written to the buffer.
+  /// @returns The number of bytes that has been sucessfully written.
+	size_t write( uint8_t b ) override;
+
+  /// Write a memory area to the buffer.
+  ///
+  /// @param data Pointer to the memory area.
+  /// @param size Number of bytes to write.
+  /// @returns The number of bytes that has been sucessfully written.
+	size_t write( const uint8_t *data, size_t size ) override;
+
+  /// Write the collected data to the output channel and empty the buffer.
+  void   flushBuffer();
+
+  /// Number of bytes in the buffer.
+  uint32_t length();
+
+  /// It is true, when the buffer was full and it had to be written
+  /// to the output channel since the begin function was called.
+  bool   overflowed();
+
+private:
+	Print *out = NULL;
+	uint8_t *buffer = NULL;
+	uint32_t size = 0;
+	uint32_t writePointer = 0;
+	bool overflow = false;
+
+};
 
 #endif /* COMMANDER_API_SRC_COMMANDER_IO_HPP_ */
@@ -0,0 +1,515 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <string.h>
+
+#include "Commander-Number.hpp"
+
+/// The mantissa of the parsed floats has at most this many digits.
+#define COMMANDER_FLOAT_MAX_MANTISSA 100000000UL
+
+// Powers of ten for the decomposition of the decimal exponent.
+// The i-th element is 10^( 2^i ).
+static const float commander_pow10_binary[] = { 1e1f, 1e2f, 1e4f, 1e8f, 1e16f, 1e32f };
+
+// Powers of ten for the fractional digits.
+static const uint32_t commander_pow10[] = { 1UL, 10UL, 100UL, 1000UL, 10000UL, 100000UL, 1000000UL, 10000000UL, 100000000UL, 1000000000UL };
+
+bool commanderParseInt( const char *str, int32_t *value, const char **end ){
+
+	// The next character to process.
+	const char *ptr = str;
+
+	// Absolute value of the number.
+	uint32_t result = 0;
+
+	// The largest absolute value, that is in range.
+	uint32_t limit = 2147483647UL;
+
+	// The next digit.
+	uint8_t digit;
+
+	// Number base, 10 or 16.
+	uint8_t base = 10;
+
+	bool negative = false;
+	bool hasDigits = false;
+
+	if( ( *ptr == '-' ) || ( *ptr == '+' ) ){
+
+		negative = ( *ptr == '-' );
+		ptr++;
+
+	}
+
+	if( negative ){
+
+		limit = 2147483648UL;
+
+	}
+
+	if( ( ptr[ 0 ] == '0' ) && ( ( ptr[ 1 ] == 'x' ) || ( ptr[ 1 ] == 'X' ) ) ){
+
+		base = 16;
+		ptr += 2;
+
+	}
+
+	while( true ){
+
+		if( ( *ptr >= '0' ) && ( *ptr <= '9' ) ){
+
+			digit = *ptr - '0';
+
+		}
+
+		else if( ( base == 16 ) && ( ( *ptr | 0x20 ) >= 'a' ) && ( ( *ptr | 0x20 ) <= 'f' ) ){
+
+			digit = ( *ptr | 0x20 ) - 'a' + 10;
+
+		}
+
+		else{
+
+			break;
+
+		}
+
+		// The result would be greater than the limit.
+		if( result > ( limit - digit ) / base ){
+
+			if( end != NULL ){
+
+				*end = str;
+
+			}
+
+			return false;
+
+		}
+
+		result = result * base + digit;
+		hasDigits = true;
+		ptr++;
+
+	}
+
+	if( end != NULL ){
+
+		*end = ptr;
+
+	}
+
+	// At least one digit is needed and nothing can follow the number.
+	if( !hasDigits || ( *ptr != '\0' ) ){
+
+		return false;
+
+	}
+
+	*value = negative ? (int32_t)( 0 - result ) : (int32_t)result;
+	return true;
+
+}
+
+bool commanderParseFloat( const char *str, float *value, const char **end ){
+
+	// The next character to process.
+	const char *ptr = str;
+
+	// The significant digits and the decimal exponent of the number.
+	uint32_t mantissa = 0;
+	int16_t exponent = 0;
+
+	// The exponent after the 'e' character.
+	int16_t exponentPart = 0;
+	bool exponentNegative = false;
+
+	// Generic counter variable.
+	uint8_t i;
+
+	bool negative = false;
+	bool hasDigits = false;
+
+	float result;
+
+	if( ( *ptr == '-' ) || ( *ptr == '+' ) ){
+
+		negative = ( *ptr == '-' );
+		ptr++;
+
+	}
+
+	// Integer part. The digits, that do not fit in
+	// the mantissa, only increase the exponent.
+	while( ( *ptr >= '0' ) && ( *ptr <= '9' ) ){
+
+		if( mantissa < COMMANDER_FLOAT_MAX_MANTISSA ){
+
+			mantissa = mantissa * 10 + ( *ptr - '0' );
+
+		}
+
+		else{
+
+			exponent++;
+
+		}
+
+		hasDigits = true;
+		ptr++;
+
+	}
+
+	// Fractional part.
+	if( *ptr == '.' ){
+
+		ptr++;
+
+		while( ( *ptr >= '0' ) && ( *ptr <= '9' ) ){
+
+			if( mantissa < COMMANDER_FLOAT_MAX_MANTISSA ){
+
+				mantissa = mantissa * 10 + ( *ptr - '0' );
+				exponent--;
+
+			}
+
+			hasDigits = true;
+			ptr++;
+
+		}
+
+	}
+
+	if( !hasDigits ){
+
+		if( end != NULL ){
+
+			*end = ptr;
+
+		}
+
+		return false;
+
+	}
+
+	// Exponent part.
+	if( ( *ptr == 'e' ) || ( *ptr == 'E' ) ){
+
+		ptr++;
+
+		if( ( *ptr == '-' ) || ( *ptr == '+' ) ){
+
+			exponentNegative = ( *ptr == '-' );
+			ptr++;
+
+		}
+
+		if( ( *ptr < '0' ) || ( *ptr > '9' ) ){
+
+			if( end != NULL ){
+
+				*end = ptr;
+
+			}
+
+			return false;
+
+		}
+
+		while( ( *ptr >= '0' ) && ( *ptr <= '9' ) ){
+
+			// Bigger exponents are out of range anyway.
+			if( exponentPart < 1000 ){
+
+				exponentPart = exponentPart * 10 + ( *ptr - '0' );
+
+			}
+
+			ptr++;
+
+		}
+
+		exponent += exponentNegative ? -exponentPart : exponentPart;
+
+	}
+
+	if( end != NULL ){
+
+		*end = ptr;
+
+	}
+
+	if( *ptr != '\0' ){
+
+		return false;
+
+	}
+
+	result = (float)mantissa;
+
+	if( mantissa != 0 ){
+
+		// The limits of float with a nine digit mantissa.
+		if( exponent > 39 ){
+
+			if( end != NULL ){
+
+				*end = str;
+
+			}
+
+			return false;
+
+		}
+
+		if( exponent < -54 ){
+
+			exponent = -54;
+
+		}
+
+		// The exponent is decomposed to powers of two,
+		// so at most six multiplications are needed.
+		for( i = 0; i < sizeof( commander_pow10_binary ) / sizeof( commander_pow10_binary[ 0 ] ); i++ ){
+
+			if( exponent > 0 ){
+
+				if( exponent & ( 1 << i ) ){
+
+					result *= commander_pow10_binary[ i ];
+
+				}
+
+			}
+
+			else{
+
+				if( ( -exponent ) & ( 1 << i ) ){
+
+					result /= commander_pow10_binary[ i ];
+
+				}
+
+			}
+
+		}
+
+		// Overflow in the last multiplication.
+		if( result > 3.4028235e38f ){
+
+			if( end != NULL ){
+
+				*end = str;
+
+			}
+
+			return false;
+
+		}
+
+	}
+
+	*value = negative ? -result : result;
+	return true;
+
+}
+
+uint8_t commanderFormatInt( char *buffer, int32_t value ){
+
+	// The digits are generated backwards to this buffer.
+	char digits[ 10 ];
+
+	// Absolute value of the number.
+	uint32_t absolute;
+
+	uint8_t length = 0;
+	uint8_t count = 0;
+
+	if( value < 0 ){
+
+		buffer[ length ] = '-';
+		length++;
+		absolute = 0 - (uint32_t)value;
+
+	}
+
+	else{
+
+		absolute = value;
+
+	}
+
+	do{
+
+		digits[ count ] = '0' + ( absolute % 10 );
+		count++;
+		absolute /= 10;
+
+	}while( absolute > 0 );
+
+	while( count > 0 ){
+
+		count--;
+		buffer[ length ] = digits[ count ];
+		length++;
+
+	}
+
+	buffer[ length ] = '\0';
+	return length;
+
+}
+
+uint8_t commanderFormatFloat( char *buffer, float value, uint8_t digits ){
+
+	// Integer and fractional part of the number.
+	uint32_t integer;
+	uint32_t fraction;
+
+	// The rounding is calculated with double precision, where it is
+	// available, so the digits of the float value are exact.
+	double number;
+
+	uint8_t length = 0;
+
+	// Generic counter variable.
+	int8_t i;
+
+	// Same special values as Print::print( float ) prints.
+	if( value != value ){
+
+		memcpy( buffer, "nan", 4 );
+		return 3;
+
+	}
+
+	if( ( value > 4294967040.0f ) || ( value < -4294967040.0f ) ){
+
+		// Infinity is out of range as well.
+		if( ( value - value ) != 0.0f ){
+
+			memcpy( buffer, "inf", 4 );
+			return 3;
+
+		}
+
+		memcpy( buffer, "ovf", 4 );
+		return 3;
+
+	}
+
+	if( digits > COMMANDER_FLOAT_MAX_DIGITS ){
+
+		digits = COMMANDER_FLOAT_MAX_DIGITS;
+
+	}
+
+	number = value;
+
+	if( number < 0.0 ){
+
+		buffer[ length ] = '-';
+		length++;
+		number = -number;
+
+	}
+
+	// Round to the last printed digit.
+	number += 0.5 / (double)commander_pow10[ digits ];
+
+	integer = (uint32_t)number;
+
+	// The unsigned integer is formatted as a positive int32_t, if it fits.
+	if( integer <= 2147483647UL ){
+
+		length += commanderFormatInt( &buffer[ length ], (int32_t)integer );
+
+	}
+
+	else{
+
+		length += commanderFormatInt( &buffer[ length ], (int32_t)( integer / 10 ) );
+		buffer[ length ] = '0' + ( integer % 10 );
+		length++;
+
+	}
+
+	if( digits > 0 ){
+
+		fraction = (uint32_t)( ( number - (double)integer ) * (double)commander_pow10[ digits ] );
+
+		// The multiplication can round up to the next integer.
+		if( fraction >= commander_pow10[ digits ] ){
+
+			fraction = commander_pow10[ digits ] - 1;
+
+		}
+
+		buffer[ length ] = '.';
+		length++;
+
+		// The fraction is padded with zeros from the left.
+		for( i = digits - 1; i >= 0; i-- ){
+
+			buffer[ length + i ] = '0' + ( fraction % 10 );
+			fraction /= 10;
+
+		}
+
+		length += digits;
+
+	}
+
+	buffer[ length ] = '\0';
+	return length;
+
+}
+
+size_t commanderPrintInt( Print *out, int32_t value ){
+
+	char buffer[ COMMANDER_NUMBER_BUFFER_SIZE ];
+
+	return out -> write( (const uint8_t*)buffer, commanderFormatInt( buffer, value ) );
+
+}
+
+size_t commanderPrintFloat( Print *out, float value, uint8_t digits ){
+
+	char buffer[ COMMANDER_NUMBER_BUFFER_SIZE ];
+
+	return out -> write( (const uint8_t*)buffer, commanderFormatFloat( buffer, value, digits ) );
+
+}
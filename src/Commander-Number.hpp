@@ -0,0 +1,105 @@
+/*
+ * Created on October 16 2026
+ *
+ * Copyright (c) 2020 - Daniel Hajnal
+ * hajnal.daniel96@gmail.com
+ * This file is part of the Commander-API project.
+ * Modified 2026.10.16
+*/
+
+/*
+MIT License
+
+Copyright (c) 2020 Daniel Hajnal
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef COMMANDER_API_SRC_COMMANDER_NUMBER_HPP_
+#define COMMANDER_API_SRC_COMMANDER_NUMBER_HPP_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "Stream.h"
+
+/// Number parsing and formatting for the command functions.
+///
+/// These functions do not allocate memory and do not use the
+/// scanf / printf family, so they are small and fast on the
+/// microcontrollers. The parsers are strict, the whole string
+/// has to be a number, and the position of the error is reported.
+
+/// Size of a buffer, that can hold any formatted number with the terminator.
+#define COMMANDER_NUMBER_BUFFER_SIZE 24
+
+/// Maximum number of fractional digits in the float formatting.
+#define COMMANDER_FLOAT_MAX_DIGITS 9
+
+/// Parse a 32-bit integer.
+///
+/// Decimal and hexadecimal( 0x prefix ) numbers are accepted
+/// with an optional sign.
+/// @param str The terminated string of the number.
+/// @param value The result is stored here, if the parsing is successful.
+/// @param end If it is not NULL, the position of the first character that
+///            is not part of the number is stored here. It points to the
+///            terminator after a successful parsing, to the wrong
+///            character if the format is wrong, or to the beginning
+///            of the string if the number is out of range.
+/// @returns True, if the whole string is a number in the range of int32_t.
+bool commanderParseInt( const char *str, int32_t *value, const char **end = NULL );
+
+/// Parse a floating point number.
+///
+/// The accepted format is [ sign ] digits [ . digits ] [ e [ sign ] digits ].
+/// The digits after the ninth significant digit are ignored, so the
+/// result can differ from the nearest float value in the last bit.
+/// @param str The terminated string of the number.
+/// @param value The result is stored here, if the parsing is successful.
+/// @param end Same as at commanderParseInt.
+/// @returns True, if the whole string is a number in the range of float.
+bool commanderParseFloat( const char *str, float *value, const char **end = NULL );
+
+/// Format an integer.
+/// @param buffer At least COMMANDER_NUMBER_BUFFER_SIZE bytes long buffer.
+/// @param value The number to format.
+/// @returns The number of characters without the terminator.
+uint8_t commanderFormatInt( char *buffer, int32_t value );
+
+/// Format a floating point number.
+///
+/// The output is the same as the output of Print::print( float, digits ),
+/// the numbers out of the range of uint32_t are printed as ovf.
+/// @param buffer At least COMMANDER_NUMBER_BUFFER_SIZE bytes long buffer.
+/// @param value The number to format.
+/// @param digits Number of fractional digits, maximum COMMANDER_FLOAT_MAX_DIGITS.
+/// @returns The number of characters without the terminator.
+uint8_t commanderFormatFloat( char *buffer, float value, uint8_t digits = 2 );
+
+/// Print an integer to a channel.
+/// @returns The number of printed characters.
+size_t commanderPrintInt( Print *out, int32_t value );
+
+/// Print a floating point number to a channel.
+/// @returns The number of printed characters.
+size_t commanderPrintFloat( Print *out, float value, uint8_t digits = 2 );
+
+#endif /* COMMANDER_API_SRC_COMMANDER_NUMBER_HPP_ */
@@ -37,6 +37,10 @@ SOFTWARE.
 
 #ifdef ESP32
 
+  #ifndef COMMANDER_LOOKUP_CACHE_SIZE
+    #define COMMANDER_LOOKUP_CACHE_SIZE 8
+  #endif
+
   #ifndef COMMANDER_USE_WIFI_CLIENT_RESPONSE
     #define COMMANDER_USE_WIFI_CLIENT_RESPONSE
   #endif
@@ -53,6 +57,10 @@ SOFTWARE.
 
 #ifdef ESP8266
 
+  #ifndef COMMANDER_LOOKUP_CACHE_SIZE
+    #define COMMANDER_LOOKUP_CACHE_SIZE 8
+  #endif
+
   #ifndef COMMANDER_USE_WIFI_CLIENT_RESPONSE
     #define COMMANDER_USE_WIFI_CLIENT_RESPONSE
   #endif
@@ -70,9 +78,129 @@ SOFTWARE.
 // Enable the Pipe module by default
 #define COMMANDER_ENABLE_PIPE_MODULE
 
-/// Maximum length of the terminal command.
+/// Compile time hash table support.
+///
+/// It requires C++14, because the table is generated by constexpr functions.
+#if !defined( COMMANDER_DISABLE_HASH_TABLE ) && ( __cplusplus >= 201402L )
+  #define COMMANDER_ENABLE_HASH_TABLE
+#endif
+
+/// Size of the command buffers of the Commander type and the prepared commands.
+/// The objects with other sizes can be created with the CommanderSized template.
 #ifndef COMMANDER_MAX_COMMAND_SIZE
   #define COMMANDER_MAX_COMMAND_SIZE 30
 #endif
 
+/// Maximum number of bytes read by one call of the update function.
+#ifndef COMMANDER_UPDATE_BYTE_BUDGET
+  #define COMMANDER_UPDATE_BYTE_BUDGET 64
+#endif
+
+/// Maximum number of arguments in a commanderArgs list.
+#ifndef COMMANDER_MAX_ARGUMENTS
+  #define COMMANDER_MAX_ARGUMENTS 8
+#endif
+
+/// Maximum number of commands in a prepared pipeline.
+#ifndef COMMANDER_MAX_PIPE_STAGES
+  #define COMMANDER_MAX_PIPE_STAGES 4
+#endif
+
+/// Maximum number of parameter slots in a prepared command.
+/// The slots are stored as control characters, so it can be at most 8.
+#ifndef COMMANDER_MAX_PARAMETERS
+  #define COMMANDER_MAX_PARAMETERS 4
+#endif
+
+/// Maximum number of API-trees merged in one search index.
+#ifndef COMMANDER_MAX_TREE_COUNT
+  #define COMMANDER_MAX_TREE_COUNT 4
+#endif
+
+/// Maximum number of API-trees attached to one object with the
+/// attachTree and appendTree macros. Every tree costs a pointer
+/// and a size in every object, so only one is stored by default.
+#ifndef COMMANDER_MAX_ATTACHED_TREES
+  #define COMMANDER_MAX_ATTACHED_TREES 1
+#endif
+
+#if ( COMMANDER_MAX_ATTACHED_TREES < 1 ) || ( COMMANDER_MAX_ATTACHED_TREES > COMMANDER_MAX_TREE_COUNT )
+  #error "COMMANDER_MAX_ATTACHED_TREES has to be between 1 and COMMANDER_MAX_TREE_COUNT!"
+#endif
+
+/// Uncomment to enable the help buffer.
+///
+/// The help text can be collected in a buffer attached with the
+/// attachHelpBuffer function, and the full listing can be cached.
+/// It costs the state of the buffer in every object.
+//#define COMMANDER_ENABLE_HELP_BUFFER
+
+/// Uncomment to ignore the case of the command names.
+///
+/// The names are folded to lower case when the search index
+/// is created, and the incoming command name is folded once,
+/// so the search is as fast as the case-sensitive one.
+//#define COMMANDER_CASE_INSENSITIVE
+
+/// Uncomment to share a search index between tasks.
+///
+/// The index can be replaced while the other tasks are searching
+/// in it. It needs the atomic and mutex headers of the C++ library,
+/// and every lookup marks the index as used, so it is opt-in.
+//#define COMMANDER_ENABLE_SHARED_INDEX
+
+/// Uncomment to build the lean profile.
+///
+/// The descriptions are removed from the API_t structure and the
+/// apiElement macros drop them, so the description texts are not
+/// compiled to the binary. The '?' handler and the styled help are
+/// removed as well, the help command only lists the command names.
+/// It is useful for small devices, that are used by machine clients.
+//#define COMMANDER_LEAN
+
+/// Uncomment to store the descriptions compressed.
+///
+/// The common phrases of the descriptions are replaced with one byte
+/// tokens of the shared dictionary( see Commander-Dictionary.hpp ).
+/// The tokens are expanded in small chunks directly to the response
+/// channel, so the full description is never stored in RAM.
+/// @note The descriptions can not contain non-ASCII characters
+///       in this mode, because they are used as tokens.
+//#define COMMANDER_COMPRESSED_DESCRIPTIONS
+
+/// Size of the buffer, that is used to expand the compressed
+/// descriptions. It is allocated on the stack while printing.
+#ifndef COMMANDER_DESCRIPTION_CHUNK_SIZE
+  #define COMMANDER_DESCRIPTION_CHUNK_SIZE 16
+#endif
+
+/// Uncomment to count the comparisons of the command search.
+/// It is useful for benchmarking.
+//#define COMMANDER_ENABLE_STATISTICS
+
+/// Number of entries in the lookup cache.
+///
+/// The recently used commands are stored in this cache, so a
+/// repeated command is found without the search. 0 disables it.
+#ifndef COMMANDER_LOOKUP_CACHE_SIZE
+  #define COMMANDER_LOOKUP_CACHE_SIZE 0
+#endif
+
+/// Uncomment to enable the frequency weighted search tree.
+///
+/// The usage of every command is counted and the search tree can
+/// be rebuilt, so the frequently used commands are found faster.
+//#define COMMANDER_ENABLE_WEIGHTED_SEARCH
+
+/// The weighted search tree is rebuilt automatically after this
+/// many command searches. 0 means it is rebuilt only on request.
+#ifndef COMMANDER_WEIGHTED_REBUILD_PERIOD
+  #define COMMANDER_WEIGHTED_REBUILD_PERIOD 0
+#endif
+
+/// Number of commands on one page of the help command.
+#ifndef COMMANDER_HELP_PAGE_SIZE
+  #define COMMANDER_HELP_PAGE_SIZE 20
+#endif
+
 #endif /* COMMANDER_API_SRC_COMMANDER_SETTINGS_HPP_ */